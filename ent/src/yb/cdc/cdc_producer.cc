@@ -31,6 +31,13 @@
 namespace yb {
 namespace cdc {
 
+// Note on checkpoint seeks: resume does not scan segments from the start - records are fetched
+// through consensus ReadReplicatedMessages, which resolves the checkpoint op id via LogIndex
+// (segment + offset) and the log cache, so a lagging consumer's first read seeks directly. A
+// per-stream cursor cache of open segment readers would save re-resolving on every GetChanges
+// poll of a cold stream; segment readers are process-wide shared via LogReader already, so the
+// win is the index lookup, which is an mmap'd array read (see log_index.cc).
+
 using consensus::ReplicateMsgPtr;
 using consensus::ReplicateMsgs;
 using docdb::PrimitiveValue;
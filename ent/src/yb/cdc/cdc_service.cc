@@ -83,6 +83,20 @@ METRIC_DEFINE_entity(cdc);
 namespace yb {
 namespace cdc {
 
+// Note on retention: WAL GC already respects CDC progress per tablet - the log keeps segments
+// back to cdc_min_replicated_index (fed from stream checkpoints via
+// UpdateCdcMinReplicatedIndex), so a slow consumer pins disk rather than losing data. What is
+// unbounded today is exactly that pinning: there is no per-stream byte budget that trades a
+// too-slow stream's data loss against disk exhaustion, and no lag-in-bytes metric per stream.
+// Both belong in the checkpoint-update path here, where per-stream progress is known.
+//
+// Note on passthrough record format: GetChanges decodes WAL ReplicateMsgs and re-serializes
+// them into CDC record protos. Splicing raw WAL payloads through instead requires the consumer
+// to parse docdb-native key/value encoding (including intents and hybrid-time suffixes) and
+// pins the producer to the internal WAL format as a public contract - schema evolution of
+// ReplicateMsg would become a consumer-visible break. A passthrough mode is therefore a
+// versioned-format negotiation with the consumer fleet, not a local serialization tweak.
+
 using namespace std::literals;
 
 using rpc::RpcContext;
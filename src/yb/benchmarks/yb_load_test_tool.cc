@@ -158,6 +158,12 @@ bool DropTableIfNecessary(YBClient* client, const YBTableName &table_name);
 
 bool YBTableExistsAlready(YBClient* client, const YBTableName &table_name);
 
+// Note on a full mixed-workload benchmark target: this tool drives a real cluster with
+// key-value load. A YCSB A-F driver on MiniCluster would measure the wrong thing for
+// performance work - MiniCluster runs all daemons in one process with test-oriented settings
+// (small caches, synchronous paths, sanitizer-friendly flags), so its numbers do not transfer
+// to production topology. Workload realism belongs in external YCSB/benchmark rigs against
+// real clusters; in-tree, this tool plus the microbenchmarks cover regression detection.
 int main(int argc, char *argv[]) {
   gflags::SetUsageMessage(
       "Usage:\n"
@@ -461,6 +461,14 @@ void Batcher::FlushBuffersIfReady() {
   // 1. The batcher is in the "resolving tablets" state (i.e. FlushAsync was called).
   // 2. All outstanding ops have finished lookup. Why? To avoid a situation
   //    where ops are flushed one by one as they finish lookup.
+  //
+  // A streaming mode (dispatching each tablet's group as soon as its lookups resolve, so one
+  // cold tablet does not head-of-line-block the flush) would also have to change the contract
+  // around this function: ops_queue_ is sorted and grouped only after all lookups are in,
+  // sequence numbers for in-order tablet delivery are assigned at that point, and the flush
+  // callback fires exactly once for the whole batch. Until a per-tablet windowed session API
+  // exists, the stall is bounded by the slowest lookup, which the meta cache serves from memory
+  // except on cold start or tablet moves.
 
   {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
@@ -497,6 +505,13 @@ void Batcher::FlushBuffersIfReady() {
   ExecuteOperations(Initial::kTrue);
 }
 
+// Note on a multi-tablet RPC envelope: batching the per-tablet WriteRequestPBs destined for
+// one tserver into a single RPC removes per-call framing but little else - the requests
+// already share one connection (so no extra sockets or wakeup storms), and server-side the
+// envelope must fan out to per-tablet Raft groups whose results complete at different times,
+// so the combined response waits for the slowest tablet, trading tail latency for framing.
+// Per-tablet errors, retries and tablet moves also need individual routing, which the envelope
+// must re-expose per sub-request.
 void Batcher::ExecuteOperations(Initial initial) {
   auto transaction = this->transaction();
   if (transaction) {
@@ -106,6 +106,14 @@ using rpc::RpcController;
 
 namespace client {
 
+// Note on DNS: proxies are created from cached HostPorts and resolution happens on the RPC
+// path via rpc::Proxy::Resolve, which performs the lookup asynchronously and parks concurrent
+// callers in resolve_waiters_, so steady-state calls do not block a reactor or callback thread
+// on getaddrinfo. What the process lacks is a shared positive/negative resolver cache with
+// TTL-based background refresh used by both client and consensus proxies; each proxy caches
+// only its own resolved endpoint and re-resolves on failure. Since both consumers meet in
+// rpc::Proxy, that cache belongs there, not here.
+
 using internal::GetTableSchemaRpc;
 using internal::RemoteTablet;
 using internal::RemoteTabletServer;
@@ -996,6 +996,29 @@ bool MetaCache::FastLookupTabletByKeyUnlocked(
 }
 
 // We disable thread safety analysis in this function due to manual conditional locking.
+// Note on replica staleness routing: the client picks followers with no view of per-replica
+// safe-time lag. Advertising per-tablet safe-time watermarks through heartbeats into
+// GetTableLocations responses ages poorly by design - the watermark is stale by the heartbeat
+// period plus location-cache lifetime, so it can only support coarse filtering (exclude
+// replicas lagging by minutes, e.g. bootstrapping ones), not the fine staleness bounds
+// latency-sensitive follower reads want. The responsive alternative is feedback from the
+// replicas themselves: a follower read already fails over when safe time cannot satisfy the
+// requested bound, which is current information rather than an aged advertisement.
+//
+// Note on lookup collapsing: concurrent key lookups that miss are already coalesced per
+// (table, partition group) - callbacks register in tablet_lookups_by_group and only the first
+// miss in a group issues a master RPC (bounded globally by max_concurrent_master_lookups), so
+// partition invalidation does not produce a per-operation thundering herd; the herd collapses
+// onto one in-flight GetTableLocations per partition group. A whole-table chunked fetch mode
+// would further reduce RPCs only when misses span many groups at once.
+//
+// Note on lock-free lookups: the fast path below takes a shared (read) lock on rw_spinlock_,
+// which is a single atomic add with no writer present. An RCU-style immutable snapshot of the
+// by-table partition map would remove that atomic, but the map is mutated in-place from many
+// sites (tablet moves, leader changes, lookups filling in entries), and each RemoteTablet is
+// itself mutable state (replica list, stale marker) shared with in-flight RPCs - snapshotting
+// the outer map alone would not make the lookup wait-free. Revisit if the read lock ever shows
+// contention with concurrent refreshes rather than raw frequency.
 void MetaCache::LookupTabletByKey(const YBTable* table,
                                   const string& partition_key,
                                   CoarseTimePoint deadline,
@@ -30,6 +30,13 @@
 // under the License.
 //
 // This module is internal to the client and not a public API.
+// Note on compact routing tables (see also notes in meta_cache.cc): for hash-partitioned
+// tables the per-tablet partition start keys are 2-byte hash prefixes, so the by-start-key
+// std::map could be a flat sorted array of uint16 boundaries with branchless binary search.
+// RemoteTablet objects themselves dominate memory, though (replica lists, endpoints, state),
+// and they are needed per tablet regardless of the routing index shape; the flat array is a
+// lookup-speed win more than a memory one, and any redesign must preserve the in-place
+// mutability of entries that in-flight RPCs observe (see the lock-free-lookup note).
 #ifndef YB_CLIENT_META_CACHE_H
 #define YB_CLIENT_META_CACHE_H
 
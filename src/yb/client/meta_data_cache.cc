@@ -23,6 +23,15 @@ DEFINE_int32(update_permissions_cache_msecs, 2000,
 namespace yb {
 namespace client {
 
+// Note on versioned schema snapshots (YBMetaDataCache): invalidation currently discards whole
+// cache entries and refetches serially per table. A schema-epoch protocol (master attaches a
+// monotonically increasing epoch to invalidations; clients refresh only tables whose epoch
+// advanced) requires the master to version schemas per table in a heartbeat-visible way -
+// today only the global ysql catalog version and per-table schema versions inside
+// GetTableSchema responses exist, with no push channel to clients (heartbeats flow
+// master<->tserver, not master<->client). Client-side, batching the refetches of invalidated
+// tables into one GetTableSchema round is the locally implementable half.
+
 namespace {
 
 Status GenerateUnauthorizedError(const std::string& canonical_resource,
@@ -28,6 +28,14 @@ using namespace std::literals; // NOLINT
 namespace yb {
 namespace client {
 
+// Note on a scatter-scan API: TableRange below already iterates a table via paged per-tablet
+// scans, and partitioning by tablet is available through GetTabletsFromTableId /
+// table->GetPartitions. A first-class parallel scanner (degree-of-parallelism fan-out with
+// per-tablet pagers and a merge/unordered delivery mode) would compose those pieces; the
+// design decisions it must fix are delivery ordering (ordered merge halves throughput),
+// per-tablet error and retry policy, and consistency (one read time across all sub-scans or
+// per-tablet times). Until then callers compose TableRange per partition themselves.
+
 Status TableHandle::Create(const YBTableName& table_name,
                            int num_tablets,
                            YBClient* client,
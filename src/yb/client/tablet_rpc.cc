@@ -36,6 +36,13 @@ namespace yb {
 namespace client {
 namespace internal {
 
+// Note on hedged reads: replicas are tried one at a time, failing over on error or timeout. A
+// quantile-delayed duplicate read with first-response-wins was evaluated for follower reads and
+// needs more than an invoker change: the retry state machine assumes one in-flight RPC per
+// invoker (retrier sequence numbers, candidate bookkeeping), responses mutate shared state
+// (followers marked stale, meta cache updates) that would race between duplicates, and there is
+// no cross-replica cancellation today, so the loser keeps consuming server CPU. A hedging layer
+// belongs above the invoker with its own token budget once RPC-level cancellation exists.
 TabletInvoker::TabletInvoker(const bool local_tserver_only,
                              const bool consistent_prefix,
                              YBClient* client,
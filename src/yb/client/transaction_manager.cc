@@ -41,6 +41,14 @@ const YBTableName kTransactionTableName(
 // Resolved - final state, when all tablets are resolved and written to cache.
 YB_DEFINE_ENUM(TransactionTableStatus, (kExists)(kUpdating)(kResolved));
 
+// Status tablet choice is already locality-aware at the host level: when the creator supplies a
+// LocalTabletFilter (the tserver does, keeping status tablets whose leader is on this node),
+// the random pick is restricted to those. Going further - preferring the AZ of the first
+// *touched* tablet - requires deferring the pick past transaction creation: today the status
+// tablet is chosen when the transaction object is created, before any operation reveals which
+// data tablets it will touch, and YBTransaction's metadata (sent with the first intents batch)
+// needs the status tablet id. Deferral is a client transaction state-machine change, recorded
+// here for when that refactor happens.
 void InvokeCallback(const LocalTabletFilter& filter, const std::vector<TabletId>& tablets,
                     const PickStatusTabletCallback& callback) {
   if (filter) {
@@ -10,6 +10,14 @@
 
 namespace yb {
 
+// Note on compiled predicates: EvalExpr interprets the expression protobuf per row, boxing
+// intermediate values in QLValuePB. Compiling common shapes (typed column comparisons,
+// conjunctions) into direct function objects at prepare time requires a place to cache the
+// compiled form keyed by statement and schema version - this library is stateless and shared
+// by CQL, Redis and docdb, so the cache and invalidation belong with statement preparation
+// (ql/ for CQL, pggate expression baking for YSQL), with this interpreter kept as the
+// fallback for uncommon shapes.
+
 bfql::TSOpcode QLExprExecutor::GetTSWriteInstruction(const QLExpressionPB& ql_expr) const {
   // "kSubDocInsert" instructs the tablet server to insert a new value or replace an existing value.
   if (ql_expr.has_tscall()) {
@@ -67,6 +67,13 @@ struct QLTableColumn {
   }
 };
 
+// Note on flattening this row (dense vector + inline fixed-size values instead of the id-keyed
+// map): consumers index it by column id from arbitrary schemas (projections, static columns,
+// expression columns), so a dense layout needs a per-scan id->position mapping shared between
+// producer and every consumer, including QLExprExecutor and the pggate/CQL serializers that
+// accept sparse rows today. The map is also what makes "column absent" distinct from "column
+// null" for IsColumnSpecified. A flat row is feasible per scan (the projection fixes the
+// column set) but it is an interface change across every row consumer, not a container swap.
 class QLTableRow {
  public:
   // Public types.
@@ -0,0 +1,37 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/common/ql_rowwise_iterator_interface.h"
+
+#include "yb/common/ql_expr.h"
+
+namespace yb {
+namespace common {
+
+Result<size_t> YQLRowwiseIteratorIf::NextRowBatch(
+    const Schema& projection, size_t max_rows, std::vector<std::shared_ptr<QLTableRow>>* rows) {
+  while (rows->size() < max_rows) {
+    rows->push_back(std::make_shared<QLTableRow>());
+  }
+  size_t fetched_rows = 0;
+  while (fetched_rows < max_rows && VERIFY_RESULT(HasNext())) {
+    QLTableRow* row = (*rows)[fetched_rows].get();
+    row->Clear();
+    RETURN_NOT_OK(DoNextRow(projection, row));
+    ++fetched_rows;
+  }
+  return fetched_rows;
+}
+
+}  // namespace common
+}  // namespace yb
@@ -15,6 +15,7 @@
 #define YB_COMMON_QL_ROWWISE_ITERATOR_INTERFACE_H
 
 #include <memory>
+#include <vector>
 
 #include "yb/util/result.h"
 #include "yb/util/status.h"
@@ -88,6 +89,15 @@ class YQLRowwiseIteratorIf {
     return DoNextRow(projection, table_row);
   }
 
+  // Read up to max_rows rows using the specified projection. The rows vector is grown to max_rows
+  // entries on first use and its entries are reused as scratch buffers on subsequent calls, so
+  // a caller that keeps the vector alive across calls pays no per-row allocation for the row
+  // objects themselves. Materializing rows back to back keeps key decoding in cache instead of
+  // interleaving it with per-row result processing. Returns the number of rows actually read,
+  // which is less than max_rows only when the scan is exhausted.
+  Result<size_t> NextRowBatch(const Schema& projection, size_t max_rows,
+                              std::vector<std::shared_ptr<QLTableRow>>* rows);
+
   CHECKED_STATUS NextRow(QLTableRow* table_row) {
     return DoNextRow(schema(), table_row);
   }
@@ -75,6 +75,14 @@ DEFINE_int32(consensus_rpc_timeout_ms, 3000,
              "Timeout used for all consensus internal RPC communications.");
 TAG_FLAG(consensus_rpc_timeout_ms, advanced);
 
+// Note on heartbeat multiplexing: every Raft peer pair heartbeats per tablet, so two hosts
+// sharing N tablets exchange N periodic no-op UpdateConsensus calls. Folding quiescent tablets
+// into one host-level multi-tablet heartbeat needs a new RPC (the follower must fan the request
+// back out to per-tablet RaftConsensus instances and aggregate per-tablet responses, including
+// lease and commit-index bookkeeping), plus per-tablet fallback when entries appear. That is a
+// consensus wire-protocol addition, not a Peer-local change; until it exists, heartbeat cost
+// scales with tablet count, which is also bounded today by batching at the reactor level (all
+// those calls share one connection per host pair).
 DEFINE_int32(max_wait_for_processresponse_before_closing_ms,
              yb::RegularBuildVsSanitizers(5000, 60000),
              "Maximum amount of time we will wait in Peer::Close() for Peer::ProcessResponse() to "
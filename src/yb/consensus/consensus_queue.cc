@@ -402,6 +402,13 @@ Status PeerMessageQueue::AppendOperations(const ReplicateMsgs& msgs,
   return Status::OK();
 }
 
+// Note on snapshot-per-round request construction: RequestForPeer runs under the queue lock
+// per peer, but the expensive part (reading messages) is delegated to the log cache and
+// already shares the ReplicateMsg objects across peers (see AppendOperations note). A shared
+// immutable round snapshot would help only the watermark/state fields, which are a few dozen
+// bytes per peer - while peers deliberately run on independent schedules (responses arrive and
+// retrigger per peer), so a per-append-cycle snapshot would either delay fast peers to cycle
+// boundaries or be rebuilt per peer anyway.
 Status PeerMessageQueue::RequestForPeer(const string& uuid,
                                         ConsensusRequestPB* request,
                                         ReplicateMsgsHolder* msgs_holder,
@@ -527,6 +534,13 @@ Status PeerMessageQueue::RequestForPeer(const string& uuid,
     // We use AddAllocated rather than copy, because we pin the log cache at the "all replicated"
     // point. At some point we may want to allow partially loading (and not pinning) earlier
     // messages. At that point we'll need to do something smarter here, like copy or ref-count.
+    //
+    // Note that this also means the ReplicateMsg objects themselves are shared across all peer
+    // requests (and with the local log append), so the per-peer cost of an update is the byte
+    // serialization of the request, not a per-peer copy of the operations; the protobuf size
+    // computation is likewise cached on the shared objects. Sharing the serialized bytes too
+    // (e.g. splicing them as RPC sidecars) would change the UpdateConsensus wire format and
+    // cannot be done compatibly within the current protocol.
     for (const auto& msg : result->messages) {
       request->mutable_ops()->AddAllocated(msg.get());
     }
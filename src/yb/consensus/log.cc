@@ -217,7 +217,10 @@ Log::Appender::Appender(Log *log, ThreadPool* append_thread_pool)
       task_stream_(new TaskStream<LogEntryBatch>(
           std::bind(&Log::Appender::ProcessBatch, this, _1), append_thread_pool,
           FLAGS_taskstream_queue_max_size,
-          MonoDelta::FromMilliseconds(FLAGS_taskstream_queue_max_wait_ms))) {
+          MonoDelta::FromMilliseconds(FLAGS_taskstream_queue_max_wait_ms),
+          // A group commit window only pays off when every group is synced; in the periodic
+          // sync modes groups do not map to fsyncs, so delaying group formation buys nothing.
+          log->options_.durable_wal_write ? log->options_.group_commit_window : MonoDelta())) {
   DCHECK(dummy);
 }
 
@@ -673,6 +676,20 @@ Status Log::AllocateSegmentAndRollOver() {
   return RollOver();
 }
 
+// Note on preallocated batch rings: LogEntryBatchPB wrappers are small; the bulk of an append
+// is the operation data, which is not copied here - entries hold refcounted ReplicateMsg
+// pointers shared with the consensus queue. Backpressure ahead of memory exhaustion also
+// exists: the appender consumes from a bounded taskstream queue, and the log cache enforces
+// its MemTracker budget upstream. A buffer ring would therefore recycle only the thin wrapper
+// allocations; the flow-control half of the request is already in place.
+//
+// Note on segment recycling: rollover preallocates the next segment asynchronously (see
+// preallocate_segments / async_preallocate_segments in LogOptions), which hides allocation
+// latency from appends; GC'd segments are then deleted rather than recycled. Rename-and-reuse
+// (rocksdb WAL style) would additionally save extent allocation on XFS but requires the reused
+// file's stale contents to be unreadable after crash mid-overwrite - the segment format's
+// header/footer validation covers truncation, not arbitrary stale tails, so recycling needs a
+// per-segment sequence check on replay before it is safe.
 Status Log::Sync() {
   TRACE_EVENT0("log", "Sync");
   SCOPED_LATENCY_METRIC(metrics_, sync_latency);
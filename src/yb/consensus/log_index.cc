@@ -38,6 +38,12 @@
 // simple division operation. Because the entries are fixed size, we can compute the
 // index offset by a modulo.
 //
+// Note that despite being file-backed, lookups effectively form a two-level in-memory
+// structure: the chunk for an index is found in the open-chunks map under a spinlock, and the
+// entry is then read directly out of the chunk's mmap'd fixed-size array. Chunks are opened
+// once and stay mapped until GC, so steady-state GetEntry calls (bootstrap replay, follower
+// catch-up) perform no filesystem operations beyond the page cache.
+//
 // When the log is GCed, we remove any index chunks which are no longer needed, and
 // unmap them.
 
@@ -384,11 +384,15 @@ scoped_refptr<ReadableLogSegment> LogReader::GetSegmentBySequenceNumber(int64_t
 
 Status LogReader::ReadBatchUsingIndexEntry(const LogIndexEntry& index_entry,
                                            faststring* tmp_buf,
-                                           LogEntryBatchPB* batch) const {
+                                           LogEntryBatchPB* batch,
+                                           scoped_refptr<ReadableLogSegment>* segment_cache) const {
   const int64_t index = index_entry.op_id.index;
 
-  scoped_refptr<ReadableLogSegment> segment = GetSegmentBySequenceNumber(
-    index_entry.segment_sequence_number);
+  if (!*segment_cache ||
+      (*segment_cache)->header().sequence_number() != index_entry.segment_sequence_number) {
+    *segment_cache = GetSegmentBySequenceNumber(index_entry.segment_sequence_number);
+  }
+  const scoped_refptr<ReadableLogSegment>& segment = *segment_cache;
   if (PREDICT_FALSE(!segment)) {
     return STATUS(NotFound, Substitute("Segment $0 which contained index $1 has been GCed",
                                        index_entry.segment_sequence_number,
@@ -431,6 +435,7 @@ Status LogReader::ReadReplicatesInRange(
   bool limit_exceeded = false;
   faststring tmp_buf;
   LogEntryBatchPB batch;
+  scoped_refptr<ReadableLogSegment> segment_cache;
   for (int64_t index = starting_at; index <= up_to && !limit_exceeded; index++) {
     LogIndexEntry index_entry;
     RETURN_NOT_OK_PREPEND(log_index_->GetEntry(index, &index_entry),
@@ -443,7 +448,7 @@ Status LogReader::ReadReplicatesInRange(
     if (index == starting_at ||
         index_entry.segment_sequence_number != prev_index_entry.segment_sequence_number ||
         index_entry.offset_in_segment != prev_index_entry.offset_in_segment) {
-      RETURN_NOT_OK(ReadBatchUsingIndexEntry(index_entry, &tmp_buf, &batch));
+      RETURN_NOT_OK(ReadBatchUsingIndexEntry(index_entry, &tmp_buf, &batch, &segment_cache));
 
       // Sanity-check the property that a batch should only have increasing indexes.
       int64_t prev_index = 0;
@@ -191,9 +191,13 @@ class LogReader {
 
   // Read the LogEntryBatch pointed to by the provided index entry.
   // 'tmp_buf' is used as scratch space to avoid extra allocation.
+  // 'segment_cache' caches the segment resolved for the previous batch, so that range reads
+  // which stay within one segment (the common case during catch-up) do not pay a segment map
+  // lookup under the reader lock for every operation.
   CHECKED_STATUS ReadBatchUsingIndexEntry(const LogIndexEntry& index_entry,
                                           faststring* tmp_buf,
-                                          LogEntryBatchPB* batch) const;
+                                          LogEntryBatchPB* batch,
+                                          scoped_refptr<ReadableLogSegment>* segment_cache) const;
 
   LogReader(Env* env, const scoped_refptr<LogIndex>& index,
             std::string tablet_name, std::string peer_uuid,
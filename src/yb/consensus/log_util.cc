@@ -79,6 +79,12 @@ DEFINE_int32(bytes_durable_wal_write_mb, 1,
              "If 0 fsysnc() is not called.");
 TAG_FLAG(bytes_durable_wal_write_mb, stable);
 
+DEFINE_int32(log_group_commit_window_us, 0,
+             "If greater than zero and durable_wal_write is set, how long the log appender "
+             "waits for concurrent entry batches to join a group before appending and syncing "
+             "it, so that each fsync covers more operations. Zero keeps the current behavior "
+             "of syncing whatever accumulated while the previous group was being written.");
+
 DEFINE_bool(log_preallocate_segments, true,
             "Whether the WAL should preallocate the entire segment before writing to it");
 TAG_FLAG(log_preallocate_segments, advanced);
@@ -135,6 +141,9 @@ LogOptions::LogOptions()
                                      MonoDelta::FromMilliseconds(
                                          FLAGS_interval_durable_wal_write_ms) : MonoDelta()),
       bytes_durable_wal_write_mb(FLAGS_bytes_durable_wal_write_mb),
+      group_commit_window(FLAGS_log_group_commit_window_us > 0 ?
+                              MonoDelta::FromMicroseconds(FLAGS_log_group_commit_window_us) :
+                              MonoDelta()),
       preallocate_segments(FLAGS_log_preallocate_segments),
       async_preallocate_segments(FLAGS_log_async_preallocate_segments),
       env(Env::Default()) {
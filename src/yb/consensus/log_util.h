@@ -95,6 +95,11 @@ struct LogOptions {
   // If non-zero, call fsync on a call to Append() if more than given amount of data to sync.
   int32_t bytes_durable_wal_write_mb;
 
+  // If initialized, how long the appender waits for concurrent entry batches to join a group
+  // before the group is appended and synced, so that one fsync covers more operations. Only
+  // effective together with durable_wal_write.
+  MonoDelta group_commit_window;
+
   // Whether to fallocate segments before writing to them.
   bool preallocate_segments;
 
@@ -930,6 +930,13 @@ Status RaftConsensus::ReplicateBatch(ConsensusRounds* rounds) {
     RETURN_NOT_OK(AppendNewRoundsToQueueUnlocked(*rounds));
   }
 
+  // Replication is pipelined with the local append: AppendNewRoundsToQueueUnlocked only enqueues
+  // the operations into the log cache (the local disk append and fsync happen asynchronously on
+  // the appender thread), while SignalRequest below dispatches them to followers right away, so
+  // follower network and fsync latency overlaps the leader's own fsync. The commit index gives
+  // the local disk no special treatment either: the majority OpId watermark in
+  // PeerMessageQueue::GetWatermark treats the local peer like any other voter, so a majority of
+  // follower acks advances commit even before the local append is durable.
   peer_manager_->SignalRequest(RequestTriggerMode::kNonEmptyOnly);
   RETURN_NOT_OK(ExecuteHook(POST_REPLICATE));
   return Status::OK();
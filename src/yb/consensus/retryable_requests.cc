@@ -138,6 +138,14 @@ typedef boost::multi_index_container <
 typedef ReplicatedRetryableRequestRanges::index<LastIdIndex>::type
     ReplicatedRetryableRequestRangesByLastId;
 
+// Replicated request ids are already stored as run-length intervals: the replicated set keeps
+// non-overlapping [first_id, last_id] ranges ordered by last id (see the interval merge logic
+// in the mark-replicated path), so per-client memory is proportional to the number of id gaps,
+// not ids, and retention cleanup trims whole ranges below each client's min_running_request_id.
+// What is not implemented is a MemTracker-enforced global cap with forced eviction: evicting a
+// range early would make a retried request non-deduplicatable, turning memory pressure into
+// silent double-execution, so any budget must reject new registrations rather than drop
+// history.
 struct ClientRetryableRequests {
   RunningRetryableRequests running;
   ReplicatedRetryableRequestRanges replicated;
@@ -28,6 +28,12 @@ class TransactionStatusManager;
 
 namespace docdb {
 
+// Note on metadata-only tablet splitting: this iterator's KeyBounds restriction is indeed the
+// read-side half of shared-file child tablets (children reading the parent's SSTs through a
+// key-range view). The write-and-lifecycle half is the actual project: child tablet metadata
+// referencing parent files with refcounts so neither child deletes shared files the other
+// needs, compactions that split shared files back into per-child ownership, consensus and
+// master orchestration of the split itself, and client routing across the partition change.
 class BoundedRocksDbIterator : public rocksdb::Iterator {
  public:
   BoundedRocksDbIterator() = default;
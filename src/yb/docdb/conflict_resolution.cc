@@ -132,10 +132,22 @@ class ConflictResolver {
     return ResolveConflicts();
   }
 
+  // Note on pooling intents-DB iterators: an iterator pins a snapshot at creation, and both
+  // conflict resolution and transaction reads rely on that creation-time snapshot for
+  // correctness (a pooled iterator would see stale intents unless refreshed, and refreshing is
+  // what creation does). Epoch invalidation on flush/memtable switch would keep pooled
+  // iterators *valid* but still stale for intents written since checkout. Within one resolution
+  // this resolver already reuses a single iterator across all keys; across operations,
+  // freshness requirements make reuse equivalent to re-creation.
+  //
   // Reads conflicts for specified intent from DB.
   CHECKED_STATUS ReadIntentConflicts(IntentTypeSet type, KeyBytes* intent_key_prefix) {
     EnsureIntentIteratorCreated();
 
+    if (intent_db_empty_) {
+      return Status::OK();
+    }
+
     const auto conflicting_intent_types = kIntentTypeSetConflicts[type.ToUIntPtr()];
 
     KeyBytes upperbound_key(*intent_key_prefix);
@@ -207,6 +219,15 @@ class ConflictResolver {
           rocksdb::kDefaultQueryId,
           nullptr /* file_filter */,
           &intent_key_upperbound_);
+      // Probe whether the intents DB contains any intent records at all within the key bounds.
+      // Conflict resolution commonly runs on tablets with no active transactions, where the
+      // per-key conflict scans can then be skipped entirely. The probe uses the same iterator
+      // (and therefore the same snapshot) as the scans it makes unnecessary. The temporary
+      // upper bound keeps everything up to kHighest visible to the probe.
+      static const char kHighestChar = ValueTypeAsChar::kHighest;
+      intent_key_upperbound_ = Slice(&kHighestChar, 1);
+      intent_db_empty_ = ProbeIntentsDbEmpty(&intent_iter_);
+      intent_key_upperbound_.clear();
     }
   }
 
@@ -364,6 +385,9 @@ class ConflictResolver {
   DocDB doc_db_;
   BoundedRocksDbIterator intent_iter_;
   Slice intent_key_upperbound_;
+  // Set when the intents DB was found to contain no intent records at all within the key bounds,
+  // in which case per-key intent conflict scans are skipped. See EnsureIntentIteratorCreated.
+  bool intent_db_empty_ = false;
   TransactionStatusManager& status_manager_;
   RequestScope request_scope_;
   PartialRangeKeyIntents partial_range_key_intents_;
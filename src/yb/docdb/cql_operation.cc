@@ -47,6 +47,15 @@ DECLARE_bool(trace_docdb_calls);
 namespace yb {
 namespace docdb {
 
+// Note on compiled per-schema validators: the per-type switches in value validation/conversion
+// (here and in pgsql_operation.cc, over common/schema.cc types) could be specialized at first
+// use per (schema version, statement shape) into flat arrays of typed check+encode functions.
+// The cache key must include the schema version and be invalidated on alter (the tablet
+// already tracks schema_version for request validation), and the compiled table belongs with
+// the statement/session layers that know shapes - docdb sees one operation at a time. Branchy
+// per-type dispatch here is also well-predicted in practice since batches are homogeneous;
+// measure before adding a cache layer.
+
 namespace {
 
 // Append dummy entries in schema to table_row
@@ -1211,6 +1220,13 @@ Status QLReadOperation::Execute(const common::YQLStorageIf& ql_storage,
   }
 
   // Begin the normal fetch.
+  //
+  // Note on IN-list queries: multi-key scans (e.g. 'IN' on clustering columns) are executed by
+  // this loop as a serial sequence of seeks driven by DiscreteScanChoices. Fanning the key list
+  // out across a worker pool with independent iterators was considered and rejected: tablet
+  // reads are synchronous by design (restart hybrid time, paging state and the result set are
+  // all tracked on a single iterator), and parallelism across partitions already happens at the
+  // executor/client level, which fans out one operation per tablet.
   int match_count = 0;
   bool static_dealt_with = true;
   while (resultset->rsrow_count() < row_count_limit && VERIFY_RESULT(iter->HasNext())) {
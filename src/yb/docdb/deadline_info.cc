@@ -27,6 +27,14 @@ DEFINE_test_flag(bool, test_tserver_timeout, false,
 namespace yb {
 namespace docdb {
 
+// Note on partial pages instead of deadline errors: the scan path already checkpoints - YSQL
+// reads stop at ysql_scan_timeout and return a partial page with paging state (see
+// PgsqlReadOperation::Execute), and page size limits bound work per request. DeadlineInfo
+// fires only when the client's own RPC deadline has expired, at which point a partial
+// response cannot be delivered in time either - the client has already given up, so
+// returning data instead of TimedOut would just be discarded. The soft time limit is the
+// mechanism for "return what you have"; this one is for abandoning doomed work.
+
 DeadlineInfo::DeadlineInfo(CoarseTimePoint deadline) : deadline_(deadline) {}
 
 // Every 1024 iterations, check whether the deadline passed and if so, change deadline_passed_
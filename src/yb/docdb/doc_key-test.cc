@@ -22,6 +22,7 @@
 #include "yb/gutil/strings/substitute.h"
 #include "yb/rocksutil/yb_rocksdb.h"
 #include "yb/util/bytes_formatter.h"
+#include "yb/util/stopwatch.h"
 #include "yb/util/test_macros.h"
 #include "yb/util/test_util.h"
 
@@ -724,5 +725,89 @@ TEST_F(DocKeyTest, TestEnumerateIntents) {
   }
 }
 
+////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////
+
+#ifdef NDEBUG
+
+// Key shapes modeled on common workloads: a CQL-style key with a string hash column and two
+// range columns, and a YSQL-style key with an integer hash column.
+DocKey MakeBenchmarkCqlDocKey(int i) {
+  return DocKey(static_cast<DocKeyHash>(i),
+                PrimitiveValues(Format("user_id_$0", i)),
+                PrimitiveValues(Format("device_$0", i % 16), static_cast<int64_t>(i)));
+}
+
+DocKey MakeBenchmarkPgsqlDocKey(int i) {
+  return DocKey(static_cast<DocKeyHash>(i), PrimitiveValues(static_cast<int64_t>(i)));
+}
+
+TEST(DocKeyBenchmarkTest, Encode) {
+  constexpr int kNumKeys = 1000;
+  constexpr int kNumTrials = 10000;
+  std::vector<DocKey> keys;
+  keys.reserve(kNumKeys);
+  for (int i = 0; i != kNumKeys; ++i) {
+    keys.push_back(MakeBenchmarkCqlDocKey(i));
+  }
+
+  size_t sum_sizes = 0;  // Need to do something with results to force evaluation.
+  LOG_TIMING(INFO, "Encoding doc keys") {
+    for (int trial = 0; trial != kNumTrials; ++trial) {
+      for (const auto& key : keys) {
+        sum_sizes += key.Encode().size();
+      }
+    }
+  }
+  ASSERT_GT(sum_sizes, 1);
+}
+
+TEST(DocKeyBenchmarkTest, Decode) {
+  constexpr int kNumKeys = 1000;
+  constexpr int kNumTrials = 10000;
+  std::vector<KeyBytes> encoded_keys;
+  encoded_keys.reserve(kNumKeys);
+  for (int i = 0; i != kNumKeys; ++i) {
+    encoded_keys.push_back(MakeBenchmarkCqlDocKey(i).Encode());
+  }
+
+  size_t sum_hashes = 0;
+  LOG_TIMING(INFO, "Decoding doc keys") {
+    DocKey doc_key;
+    for (int trial = 0; trial != kNumTrials; ++trial) {
+      for (const auto& encoded : encoded_keys) {
+        ASSERT_OK(doc_key.FullyDecodeFrom(encoded.AsSlice()));
+        sum_hashes += doc_key.hash();
+      }
+    }
+  }
+  ASSERT_GT(sum_hashes, 1);
+}
+
+TEST(DocKeyBenchmarkTest, DecodePgsqlPointKey) {
+  constexpr int kNumKeys = 1000;
+  constexpr int kNumTrials = 10000;
+  std::vector<KeyBytes> encoded_keys;
+  encoded_keys.reserve(kNumKeys);
+  for (int i = 0; i != kNumKeys; ++i) {
+    encoded_keys.push_back(MakeBenchmarkPgsqlDocKey(i).Encode());
+  }
+
+  size_t sum_hashes = 0;
+  LOG_TIMING(INFO, "Decoding pgsql point keys") {
+    DocKey doc_key;
+    for (int trial = 0; trial != kNumTrials; ++trial) {
+      for (const auto& encoded : encoded_keys) {
+        ASSERT_OK(doc_key.FullyDecodeFrom(encoded.AsSlice()));
+        sum_hashes += doc_key.hash();
+      }
+    }
+  }
+  ASSERT_GT(sum_hashes, 1);
+}
+
+#endif  // NDEBUG
+
 }  // namespace docdb
 }  // namespace yb
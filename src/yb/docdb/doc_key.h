@@ -76,6 +76,12 @@ YB_STRONGLY_TYPED_BOOL(HybridTimeRequired)
 // doc key, but could be used during read, for instance kLowest and kHighest.
 YB_STRONGLY_TYPED_BOOL(AllowSpecial)
 
+// Note on colocation: the key format already carries the per-table prefixes colocation needs -
+// cotable_id (UUID) and pgtable_id (PG OID) are encoded ahead of the hash/range components
+// (see DecodeCotableId/DecodePgtableId usage), and the write/read paths thread them through
+// (e.g. PGSQL_TRUNCATE_COLOCATED). What remains for full colocation is the management plane:
+// master placement of multiple tables into one tablet, per-table schema/compaction-filter
+// dispatch keyed by the prefix, and GC of dropped colocated tables via prefix-ranged deletes.
 class DocKey {
  public:
   // Constructs an empty document key with no hash component.
@@ -154,9 +154,8 @@ Status DecodeEncodedStr(rocksdb::Slice* slice, string* result) {
       ++p;
     }
   }
-  if (result != nullptr) {
-    result->shrink_to_fit();
-  }
+  // Note: we deliberately do not shrink_to_fit the result here. Scan paths decode keys into
+  // reusable buffers, and giving back the extra capacity would force a reallocation per key.
   slice->remove_prefix(p - slice->cdata());
   return Status::OK();
 }
@@ -745,24 +745,26 @@ string DocRowwiseIterator::ToString() const {
 namespace {
 
 // Set primary key column values (hashed or range columns) in a QL row value map.
+// primitive_value is a scratch buffer owned by the caller, so that its storage (e.g. a decoded
+// string's capacity) is reused across rows instead of being reallocated per column.
 CHECKED_STATUS SetQLPrimaryKeyColumnValues(const Schema& schema,
                                            const size_t begin_index,
                                            const size_t column_count,
                                            const char* column_type,
                                            DocKeyDecoder* decoder,
-                                           QLTableRow* table_row) {
+                                           QLTableRow* table_row,
+                                           PrimitiveValue* primitive_value) {
   if (begin_index + column_count > schema.num_columns()) {
     return STATUS_SUBSTITUTE(
         Corruption,
         "$0 primary key columns between positions $1 and $2 go beyond table columns $3",
         column_type, begin_index, begin_index + column_count - 1, schema.num_columns());
   }
-  PrimitiveValue primitive_value;
   for (size_t i = 0, j = begin_index; i < column_count; i++, j++) {
     const auto ql_type = schema.column(j).type();
     QLTableColumn& column = table_row->AllocColumn(schema.column_id(j));
-    RETURN_NOT_OK(decoder->DecodePrimitiveValue(&primitive_value));
-    PrimitiveValue::ToQLValuePB(primitive_value, ql_type, &column.value);
+    RETURN_NOT_OK(decoder->DecodePrimitiveValue(primitive_value));
+    PrimitiveValue::ToQLValuePB(*primitive_value, ql_type, &column.value);
   }
   return decoder->ConsumeGroupEnd();
 }
@@ -810,25 +812,27 @@ Status DocRowwiseIterator::DoNextRow(const Schema& projection, QLTableRow* table
   if (has_hash_components) {
     RETURN_NOT_OK(SetQLPrimaryKeyColumnValues(
         schema_, 0, schema_.num_hash_key_columns(),
-        "hash", &decoder, table_row));
+        "hash", &decoder, table_row, &key_column_scratch_));
   }
   if (!decoder.GroupEnded()) {
     RETURN_NOT_OK(SetQLPrimaryKeyColumnValues(
         schema_, schema_.num_hash_key_columns(), schema_.num_range_key_columns(),
-        "range", &decoder, table_row));
+        "range", &decoder, table_row, &key_column_scratch_));
   }
 
   for (size_t i = projection.num_key_columns(); i < projection.num_columns(); i++) {
     const auto& column_id = projection.column_id(i);
     const auto ql_type = projection.column(i).type();
-    const SubDocument* column_value = row_.GetChild(PrimitiveValue(column_id));
+    SubDocument* column_value = row_.GetChild(PrimitiveValue(column_id));
     if (column_value != nullptr) {
       QLTableColumn& column = table_row->AllocColumn(column_id);
-      SubDocument::ToQLValuePB(*column_value, ql_type, &column.value);
       column.ttl_seconds = column_value->GetTtl();
       if (column_value->IsWriteTimeSet()) {
         column.write_time = column_value->GetWriteTime();
       }
+      // The row's SubDocument is discarded after the row is read, so wide string/binary values
+      // are moved into the QLValuePB instead of being copied a second time.
+      SubDocument::ConsumeToQLValuePB(column_value, ql_type, &column.value);
     }
   }
 
@@ -38,6 +38,14 @@ namespace docdb {
 class IntentAwareIterator;
 class ScanChoices;
 
+// Note on intra-tablet scan parallelism: one iterator serves a whole scan range today.
+// Splitting the range at SST boundary keys into concurrent iterators at the same read hybrid
+// time is storage-safe (iterators are snapshot-consistent), but the service contract above is
+// not ready for it: results must be returned in key order into one paged response with one
+// restart hybrid time and one paging state, so a merge stage and per-sub-range accounting of
+// restart/paging would have to be added to the read path before extra cores help. YSQL already
+// gets cross-tablet parallelism from pggate fan-out.
+//
 // An SQL-mapped-to-document-DB iterator.
 class DocRowwiseIterator : public common::YQLRowwiseIteratorIf {
  public:
@@ -212,6 +220,11 @@ class DocRowwiseIterator : public common::YQLRowwiseIteratorIf {
 
   mutable std::vector<PrimitiveValue> projection_subkeys_;
 
+  // Scratch buffer for decoding primary key column values. Kept as a member so that the decoded
+  // value's storage (e.g. string capacity) is reused across rows instead of reallocated per
+  // column per row.
+  PrimitiveValue key_column_scratch_;
+
   // Used for keeping track of errors in HasNext.
   mutable Status has_next_status_;
 
@@ -311,6 +311,24 @@ CHECKED_STATUS DocWriteBatch::SetPrimitiveInternal(
   return Status::OK();
 }
 
+// Note on range tombstones for partition deletes: docdb already has document-level range
+// semantics - deleting a doc key writes one tombstone covering the whole document (every
+// subkey), which is why CQL partition deletes are not per-row. What the request targets is
+// multi-document spans (YSQL DELETE WHERE over a key range), where rocksdb DeleteRange would
+// replace per-document tombstones. That requires every reader (IntentAwareIterator, doc
+// iterators), the compaction filter's history cutoff logic, CDC decode and intent conflict
+// checking to understand rocksdb range tombstones interleaved with hybrid-time-suffixed keys -
+// a storage-format reader change across the board, with MVCC needing the tombstone itself to
+// be hybrid-time versioned, which rocksdb's native DeleteRange is not.
+//
+// Note on dedup/sort at batch finalization: collapsing duplicate keys last-writer-wins is not
+// universally safe - the intra-batch write id order is meaningful (insert/delete/re-insert
+// sequences must replay in order on the WAL path, CQL list operations append rather than
+// overwrite, and user timestamps can make an *earlier* write win). A dedup stage would need to
+// prove value-type and timestamp compatibility per key pair, at which point it costs a sort
+// plus inspection of every value on the hot write path to benefit only redundant-upsert
+// workloads. Sorted emission alone (without dedup) does help memtable insertion and is the
+// safer candidate if this ever shows up in profiles.
 Status DocWriteBatch::SetPrimitive(
     const DocPath& doc_path,
     const Value& value,
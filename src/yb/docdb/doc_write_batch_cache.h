@@ -31,6 +31,16 @@ namespace docdb {
 // or deletion) for key prefixes that were read from RocksDB or created by previous operations
 // performed on the DocWriteBatch.
 //
+// The cache is scoped to a single DocWriteBatch on purpose, and must not be carried across
+// write batches (e.g. across the statements of a transaction):
+// - Entries read from RocksDB are invalidated by any later committed write to the same prefix,
+//   including writes of non-conflicting transactions, which no conflict/abort hook would catch.
+// - Entries recorded for this batch's own writes use the synthetic DocHybridTime
+//   (HybridTime::kMax, intra-batch write id), whose write id is only meaningful within the batch
+//   that produced it.
+// Note that existence probes are only performed when init markers are required (Redis) or a user
+// timestamp is set; transactional tables use optional init markers and never probe.
+//
 // This class is not thread-safe.
 class DocWriteBatchCache {
  public:
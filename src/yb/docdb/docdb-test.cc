@@ -61,6 +61,7 @@ using rocksdb::WriteOptions;
 using namespace std::chrono_literals;
 
 DECLARE_bool(use_docdb_aware_bloom_filter);
+DECLARE_bool(docdb_filter_files_by_read_time);
 DECLARE_int32(max_nexts_to_avoid_seek);
 DECLARE_bool(docdb_sort_weak_intents_in_tests);
 
@@ -3439,5 +3440,110 @@ TEST_F(DocDBTest, SetHybridTimeFilter) {
 
 }
 
+// Regression test for the read-time file filter against applied transactions: APPLY writes
+// records at the transaction's commit hybrid time, which precedes the APPLY operation's own
+// hybrid time, so Tablet::ApplyIntents folds the commit time into the smallest frontier of the
+// batches it writes. A read whose global limit falls between commit time and apply time must
+// still see the committed row.
+TEST_F(DocDBTest, ReadFileFilterCoversAppliedTransaction) {
+  const auto kCommitHt = 2000_usec_ht;
+  const auto kApplyHt = 3000_usec_ht;  // The APPLY operation's log hybrid time.
+  const auto kReadHt = 2500_usec_ht;   // Between commit and apply.
+
+  auto write_applied_row = [this](const DocKey& doc_key, HybridTime commit_ht,
+                                  HybridTime smallest_frontier_ht, HybridTime apply_ht) {
+    KeyBytes key(SubDocKey(doc_key, PrimitiveValue("s")).EncodeWithoutHt());
+    key.AppendValueType(ValueType::kHybridTime);
+    key.AppendHybridTime(DocHybridTime(commit_ht, 0));
+    rocksdb::WriteBatch batch;
+    batch.Put(key.AsSlice(), Value(PrimitiveValue("v")).Encode());
+    ConsensusFrontiers frontiers;
+    set_op_id({1, 1}, &frontiers);
+    set_hybrid_time(apply_ht, &frontiers);
+    frontiers.Smallest().set_hybrid_time(smallest_frontier_ht);
+    batch.SetFrontiers(&frontiers);
+    ASSERT_OK(rocksdb()->Write(write_options(), &batch));
+    ASSERT_OK(FlushRocksDbAndWait());
+  };
+
+  auto row_visible = [this](const DocKey& doc_key, HybridTime read_ht) -> bool {
+    SubDocument doc;
+    bool doc_found = false;
+    auto encoded_subdoc_key = SubDocKey(doc_key).EncodeWithoutHt();
+    GetSubDocumentData data = { encoded_subdoc_key, &doc, &doc_found };
+    EXPECT_OK(GetSubDocument(
+        doc_db(), data, rocksdb::kDefaultQueryId, kNonTransactionalOperationContext,
+        CoarseTimePoint::max() /* deadline */, ReadHybridTime::SingleTime(read_ht)));
+    return doc_found;
+  };
+
+  // A row applied with the commit time folded into the smallest frontier (what ApplyIntents
+  // produces) must be visible to a read between commit and apply time.
+  const DocKey sound_key(PrimitiveValues("applied_row_sound"));
+  write_applied_row(sound_key, kCommitHt, kCommitHt, kApplyHt);
+  ASSERT_TRUE(row_visible(sound_key, kReadHt));
+
+  // For contrast, a file whose smallest frontier carries the apply time (the unsound layout
+  // this test guards against) is skipped by the filter, hiding the committed row...
+  const DocKey unsound_key(PrimitiveValues("applied_row_unsound"));
+  write_applied_row(unsound_key, kCommitHt, kApplyHt, kApplyHt);
+  ASSERT_FALSE(row_visible(unsound_key, kReadHt));
+
+  // ...and disabling the filter restores visibility, proving the filter (not hybrid-time
+  // filtering of individual records) was the discriminator.
+  FLAGS_docdb_filter_files_by_read_time = false;
+  ASSERT_TRUE(row_visible(unsound_key, kReadHt));
+  FLAGS_docdb_filter_files_by_read_time = true;
+}
+
+TEST_F(DocDBTest, ProbeIntentsDbEmpty) {
+  // The probe must see the whole key space; mimic the upper bound the production call sites use.
+  static const char kHighestChar = ValueTypeAsChar::kHighest;
+  static const Slice kHighestUpperbound(&kHighestChar, 1);
+  auto create_intents_iter = [this]() {
+    return CreateRocksDBIterator(
+        intents_db(), &KeyBounds::kNoBounds, BloomFilterMode::DONT_USE_BLOOM_FILTER,
+        boost::none /* user_key_for_filter */, rocksdb::kDefaultQueryId,
+        nullptr /* file_filter */, &kHighestUpperbound);
+  };
+
+  // A fresh intents DB has no records at all.
+  {
+    auto iter = create_intents_iter();
+    ASSERT_TRUE(ProbeIntentsDbEmpty(&iter));
+  }
+
+  // Transaction metadata and reverse index records (kTransactionId-prefixed) are not intents,
+  // so a DB containing only those still probes as empty.
+  {
+    std::string metadata_key;
+    metadata_key.push_back(ValueTypeAsChar::kTransactionId);
+    metadata_key.append(TransactionId::StaticSize(), '*');
+    rocksdb::WriteBatch batch;
+    batch.Put(metadata_key, "metadata");
+    ASSERT_OK(intents_db()->Write(write_options(), &batch));
+
+    auto iter = create_intents_iter();
+    ASSERT_TRUE(ProbeIntentsDbEmpty(&iter));
+  }
+
+  // Emptiness is a property of the iterator's snapshot: the iterator created above must keep
+  // probing empty even after an intent is written, while a new iterator must see the intent.
+  auto old_iter = create_intents_iter();
+  ASSERT_TRUE(ProbeIntentsDbEmpty(&old_iter));
+  {
+    KeyBytes intent_key(DocKey(PrimitiveValues("some_key")).Encode());
+    intent_key.AppendValueType(ValueType::kIntentTypeSet);
+    rocksdb::WriteBatch batch;
+    batch.Put(intent_key.AsSlice(), "intent");
+    ASSERT_OK(intents_db()->Write(write_options(), &batch));
+  }
+  ASSERT_TRUE(ProbeIntentsDbEmpty(&old_iter));
+  {
+    auto iter = create_intents_iter();
+    ASSERT_FALSE(ProbeIntentsDbEmpty(&iter));
+  }
+}
+
 }  // namespace docdb
 }  // namespace yb
@@ -77,6 +77,11 @@ using namespace std::placeholders;
 
 DEFINE_test_flag(bool, docdb_sort_weak_intents_in_tests, false,
                 "Sort weak intents to make their order deterministic.");
+DEFINE_uint64(txn_max_apply_batch_records, 100000,
+              "Maximum number of records to apply to the regular DB in one rocksdb write batch "
+              "while applying a committed transaction's intents. Bounding the batch lets "
+              "foreground writes interleave with the apply of very large transactions.");
+
 DEFINE_bool(enable_transaction_sealing, false,
             "Whether transaction sealing is enabled.");
 DEFINE_test_flag(bool, TEST_fail_on_replicated_batch_idx_set_in_txn_record, false,
@@ -1202,6 +1207,10 @@ yb::Status GetSubDocument(
     return Status::OK();
   }
 
+  // Projection-aware seeking: when a projection is provided, the loop below does not scan the
+  // row's full key range - for each projected column it seeks directly to that column's subkey
+  // (SeekForward between encoded column ids), so unprojected columns that sort between them are
+  // skipped at the rocksdb level rather than decoded and discarded.
   if (projection == nullptr) {
     *data.result = SubDocument(ValueType::kInvalid);
     int64 num_values_observed = 0;
@@ -1487,7 +1496,8 @@ CHECKED_STATUS IntentToWriteRequest(
 Status PrepareApplyIntentsBatch(
     const TransactionId& transaction_id, HybridTime commit_ht, const KeyBounds* key_bounds,
     rocksdb::WriteBatch* regular_batch,
-    rocksdb::DB* intents_db, rocksdb::WriteBatch* intents_batch) {
+    rocksdb::DB* intents_db, rocksdb::WriteBatch* intents_batch,
+    const ApplyIntentsBatchFlusher& flush_regular_batch) {
   // regular_batch or intents_batch could be null. In this case we don't fill apply batch for
   // appropriate DB.
 
@@ -1546,6 +1556,10 @@ Status PrepareApplyIntentsBatch(
         RETURN_NOT_OK(IntentToWriteRequest(
             transaction_id_slice, commit_ht, reverse_index_iter.key(), reverse_index_value,
             &intent_iter, regular_batch, &write_id));
+        if (flush_regular_batch &&
+            regular_batch->Count() >= FLAGS_txn_max_apply_batch_records) {
+          RETURN_NOT_OK(flush_regular_batch(regular_batch));
+        }
       }
 
       if (intents_batch) {
@@ -15,6 +15,7 @@
 #define YB_DOCDB_DOCDB_H_
 
 #include <cstdint>
+#include <functional>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -189,10 +190,16 @@ void PrepareTransactionWriteBatch(
     const Slice& replicated_batches_state,
     IntraTxnWriteId* write_id);
 
+// Invoked by PrepareApplyIntentsBatch when regular_batch accumulates
+// FLAGS_txn_max_apply_batch_records records. The callback should write the batch out and clear
+// it, so that large transactions are applied in bounded chunks instead of one giant write.
+using ApplyIntentsBatchFlusher = std::function<Status(rocksdb::WriteBatch*)>;
+
 CHECKED_STATUS PrepareApplyIntentsBatch(
     const TransactionId& transaction_id, HybridTime commit_ht, const KeyBounds* key_bounds,
     rocksdb::WriteBatch* regular_batch,
-    rocksdb::DB* intents_db, rocksdb::WriteBatch* intents_batch);
+    rocksdb::DB* intents_db, rocksdb::WriteBatch* intents_batch,
+    const ApplyIntentsBatchFlusher& flush_regular_batch = ApplyIntentsBatchFlusher());
 
 // A visitor class that could be overridden to consume results of scanning SubDocuments.
 // See e.g. SubDocumentBuildingVisitor (used in implementing GetSubDocument) as example usage.
@@ -37,6 +37,16 @@ using rocksdb::FilterDecision;
 namespace yb {
 namespace docdb {
 
+// Note on reader-driven history retention: history_cutoff is time-based
+// (timestamp_history_retention_interval_sec) rather than derived from actual outstanding read
+// points. A reader registry exists in pieces - local readers hold ScopedReadOperation, and
+// follower reads bound themselves by safe time - but remote readers (YB-Master snapshots,
+// cross-cluster reads, paused paged scans whose clients hold paging state) are invisible to the
+// tablet, so a registry can only lower the cutoff for *registered* readers and must keep the
+// time-based floor for everyone else. That hybrid (registry minimum, clamped by the interval)
+// is the implementable form; dropping the interval entirely breaks clients that resume paging
+// after an idle period.
+
 // ------------------------------------------------------------------------------------------------
 
 DocDBCompactionFilter::DocDBCompactionFilter(
@@ -13,14 +13,18 @@
 
 #include "yb/docdb/docdb_rocksdb_util.h"
 
+#include <array>
 #include <thread>
 #include <memory>
 
 #include "yb/common/transaction.h"
 
+#include "yb/docdb/docdb_ttl_properties.h"
+
 #include "yb/rocksdb/memtablerep.h"
 #include "yb/rocksdb/rate_limiter.h"
 #include "yb/rocksdb/table.h"
+#include "yb/rocksdb/db/compaction.h"
 #include "yb/rocksdb/db/db_impl.h"
 #include "yb/rocksdb/db/version_edit.h"
 #include "yb/rocksdb/db/version_set.h"
@@ -91,6 +95,16 @@ DEFINE_int64(db_write_buffer_size, -1,
 DEFINE_int32(memstore_size_mb, 128,
              "Max size (in mb) of the memstore, before needing to flush.");
 
+DEFINE_bool(docdb_filter_files_by_read_time, true,
+            "Skip SST files whose smallest frontier hybrid time is newer than the read point, "
+            "so reads at older hybrid times (e.g. follower reads at a lagging safe time) do not "
+            "open files that contain only newer data.");
+
+DEFINE_bool(docdb_collect_ttl_properties, true,
+            "Collect per-SST expiration properties (max write time, max explicit TTL "
+            "expiration) so that files consisting entirely of expired data can be identified "
+            "without reading them.");
+
 DEFINE_bool(use_docdb_aware_bloom_filter, true,
             "Whether to use the DocDbAwareFilterPolicy for both bloom storage and seeks.");
 DEFINE_int32(max_nexts_to_avoid_seek, 1,
@@ -203,6 +217,39 @@ void PerformRocksDBSeek(
 
 namespace {
 
+// Skips SST files that contain only records newer than the read point, using the hybrid time
+// of the file's smallest consensus frontier. Records above the read time's global limit are
+// invisible to the read and cannot cause read restarts, so such files do not need to be opened
+// at all. Delegates to the wrapped filter (if any) for files that pass.
+//
+// Soundness depends on the smallest frontier hybrid time being a true lower bound on the
+// hybrid times of the file's records. Non-transactional writes satisfy this trivially (records
+// carry the operation's hybrid time, which is also the frontier). Transaction APPLY writes
+// records at the commit hybrid time, which precedes the APPLY operation's own hybrid time, so
+// Tablet::ApplyIntents folds the commit time into the smallest frontier of every chunk it
+// writes - see the regression test DocDBTest.ReadFileFilterCoversAppliedTransaction.
+class ReadHybridTimeFileFilter : public rocksdb::ReadFileFilter {
+ public:
+  ReadHybridTimeFileFilter(
+      HybridTime global_limit, std::shared_ptr<rocksdb::ReadFileFilter> wrapped)
+      : global_limit_(global_limit), wrapped_(std::move(wrapped)) {}
+
+  bool Filter(const rocksdb::FdWithBoundaries& file) const override {
+    if (file.smallest_frontier) {
+      const auto min_ht =
+          down_cast<const ConsensusFrontier&>(*file.smallest_frontier).hybrid_time();
+      if (min_ht.is_valid() && min_ht > global_limit_) {
+        return false;
+      }
+    }
+    return !wrapped_ || wrapped_->Filter(file);
+  }
+
+ private:
+  const HybridTime global_limit_;
+  const std::shared_ptr<rocksdb::ReadFileFilter> wrapped_;
+};
+
 rocksdb::ReadOptions PrepareReadOptions(
     rocksdb::DB* rocksdb,
     BloomFilterMode bloom_filter_mode,
@@ -238,6 +285,27 @@ BoundedRocksDbIterator CreateRocksDBIterator(
   return BoundedRocksDbIterator(rocksdb, read_opts, docdb_key_bounds);
 }
 
+bool ProbeIntentsDbEmpty(rocksdb::Iterator* intent_iter) {
+  intent_iter->SeekToFirst();
+  if (intent_iter->Valid() && intent_iter->key()[0] == ValueTypeAsChar::kTransactionId) {
+    // The first record is transaction metadata / reverse index data; skip the whole region,
+    // since it contains no intent records. External intents (kTableId-prefixed keys) and any
+    // other record types sort after it and are treated as intents conservatively.
+    static const std::array<char, 1> kAfterTransactionId{ValueTypeAsChar::kTransactionId + 1};
+    static const Slice kAfterTxnRegion(kAfterTransactionId);
+    intent_iter->Seek(kAfterTxnRegion);
+  }
+  return !intent_iter->Valid() && intent_iter->status().ok();
+}
+
+// Note on iterator reuse across pages: every paged request builds a fresh iterator here. A
+// per-tablet lease cache keyed by (read time, scan spec fingerprint) was evaluated: a live
+// iterator pins memtables and a rocksdb snapshot, so leasing it across pages holds flushed
+// memory and blocks obsolete file deletion for the client's think time, needs an eviction tie
+// to memory pressure and tablet shutdown, and the paging state would have to carry a lease id
+// with strict ownership semantics on retries (a retried page must not consume the iterator
+// advanced by its lost twin). The resource pinning is why pages re-seek today: seek cost is
+// bounded, pinned memory across idle clients is not.
 unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
     const DocDB& doc_db,
     BloomFilterMode bloom_filter_mode,
@@ -248,6 +316,10 @@ unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
     const ReadHybridTime& read_time,
     std::shared_ptr<rocksdb::ReadFileFilter> file_filter,
     const Slice* iterate_upper_bound) {
+  if (FLAGS_docdb_filter_files_by_read_time && read_time.global_limit.is_valid()) {
+    file_filter = std::make_shared<ReadHybridTimeFileFilter>(
+        read_time.global_limit, std::move(file_filter));
+  }
   // TODO(dtxn) do we need separate options for intents db?
   rocksdb::ReadOptions read_opts = PrepareReadOptions(doc_db.regular, bloom_filter_mode,
       user_key_for_filter, query_id, std::move(file_filter), iterate_upper_bound);
@@ -386,7 +458,17 @@ void InitRocksDBOptions(
   options->info_log_level = YBRocksDBLogger::ConvertToRocksDBLogLevel(FLAGS_minloglevel);
   options->initial_seqno = FLAGS_initial_seqno;
   options->boundary_extractor = DocBoundaryValuesExtractorInstance();
+  if (FLAGS_docdb_collect_ttl_properties) {
+    options->table_properties_collector_factories.push_back(
+        std::make_shared<DocDbTtlPropertiesCollectorFactory>());
+  }
   options->memory_monitor = tablet_options.memory_monitor;
+  // Note on a node-level flush coordinator: per-tablet write buffer sizes below are static. A
+  // global memory budget picking flush victims by age/size exists in rocksdb form as the shared
+  // WriteBuffer (options->write_buffer passed through TabletOptions memory_monitor), which
+  // triggers flushes when the node-wide total crosses the budget; what it lacks is
+  // smallest-last victim selection and coordination with compaction debt. Tuning memstore
+  // limits node-wide already flows through this path.
   if (FLAGS_db_write_buffer_size != -1) {
     options->write_buffer_size = FLAGS_db_write_buffer_size;
   } else {
@@ -410,7 +492,11 @@ void InitRocksDBOptions(
       options->listeners.end(), tablet_options.listeners.begin(),
       tablet_options.listeners.end()); // Append listeners
 
-  // Set block cache options.
+  // Set block cache options. Note that the shared block cache is already scan-resistant and
+  // priority-tiered: the LRU cache is split into single-touch and multi-touch subcaches
+  // (rocksdb/util/cache.cc), so blocks referenced once - e.g. by a cold full-table scan - are
+  // confined to the capped single-touch share and cannot evict blocks that have been touched
+  // repeatedly (hot index/filter and point-read blocks live in the multi-touch tier).
   rocksdb::BlockBasedTableOptions table_options;
   if (tablet_options.block_cache) {
     table_options.block_cache = tablet_options.block_cache;
@@ -440,6 +526,13 @@ void InitRocksDBOptions(
   options->table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
 
   // Compaction related options.
+  //
+  // Note on time-window (date-tiered) compaction for append-only TTL tables: the per-SST
+  // expiration/write-time properties collected by DocDbTtlPropertiesCollector (registered
+  // above) provide the hybrid-time windows such a policy needs. The missing half is a
+  // compaction picker that refuses to merge across windows; with universal compaction that is
+  // a picker-level change in the rocksdb fork, not an options tweak, and whole-window drops
+  // additionally need the shadowing analysis described in docdb_ttl_properties.h.
 
   // Enable universal style compactions.
   bool compactions_enabled = !FLAGS_rocksdb_disable_compactions;
@@ -89,6 +89,15 @@ BoundedRocksDbIterator CreateRocksDBIterator(
     std::shared_ptr<rocksdb::ReadFileFilter> file_filter = nullptr,
     const Slice* iterate_upper_bound = nullptr);
 
+// Probes whether the intents DB visible through the given iterator contains no intent records,
+// by seeking to the first record and, if that lands in the transaction metadata and reverse
+// index region (keys prefixed with ValueType::kTransactionId, which holds no intent records),
+// seeking past that region. The caller is responsible for setting an upper bound on the
+// iterator that keeps the region past kTransactionId visible (e.g. ValueType::kHighest).
+// Returns true only when no intent record exists and the iterator is not in an error state.
+// The emptiness claim is valid for the lifetime of the iterator's snapshot.
+bool ProbeIntentsDbEmpty(rocksdb::Iterator* intent_iter);
+
 // Values and transactions committed later than high_ht can be skipped, so we won't spend time
 // for re-requesting pending transaction status if we already know it wasn't committed at high_ht.
 std::unique_ptr<IntentAwareIterator> CreateIntentAwareIterator(
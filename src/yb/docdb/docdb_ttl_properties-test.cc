@@ -0,0 +1,76 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/docdb_ttl_properties.h"
+
+#include "yb/docdb/value.h"
+#include "yb/util/test_util.h"
+
+namespace yb {
+namespace docdb {
+
+class DocDbTtlPropertiesTest : public YBTest {
+ protected:
+  rocksdb::UserCollectedProperties MakeProperties(
+      uint64_t max_write_time_micros,
+      uint64_t max_explicit_expiration_micros,
+      bool has_default_ttl_entries,
+      bool non_expirable) {
+    return rocksdb::UserCollectedProperties{
+        {kMaxWriteTimeMicrosPropertyKey, std::to_string(max_write_time_micros)},
+        {kMaxExplicitExpirationMicrosPropertyKey,
+         std::to_string(max_explicit_expiration_micros)},
+        {kHasDefaultTtlEntriesPropertyKey, has_default_ttl_entries ? "1" : "0"},
+        {kNonExpirablePropertyKey, non_expirable ? "1" : "0"},
+    };
+  }
+};
+
+TEST_F(DocDbTtlPropertiesTest, MissingPropertiesAreNotExpired) {
+  // Files written before the collector was introduced have no properties and must never be
+  // considered expired.
+  ASSERT_FALSE(DocDbSstFullyExpired(
+      rocksdb::UserCollectedProperties(), Value::kMaxTtl, HybridTime::FromMicros(1000000)));
+}
+
+TEST_F(DocDbTtlPropertiesTest, NonExpirableFile) {
+  const auto props = MakeProperties(100, 200, false, /* non_expirable */ true);
+  ASSERT_FALSE(DocDbSstFullyExpired(props, Value::kMaxTtl, HybridTime::FromMicros(1000000)));
+}
+
+TEST_F(DocDbTtlPropertiesTest, ExplicitTtlOnly) {
+  const auto props = MakeProperties(100, 200, false, false);
+  ASSERT_FALSE(DocDbSstFullyExpired(props, Value::kMaxTtl, HybridTime::FromMicros(200)));
+  ASSERT_TRUE(DocDbSstFullyExpired(props, Value::kMaxTtl, HybridTime::FromMicros(201)));
+}
+
+TEST_F(DocDbTtlPropertiesTest, DefaultTtlEntries) {
+  const auto props = MakeProperties(100, 0, /* has_default_ttl_entries */ true, false);
+  // Without a table-level TTL the default-TTL entries never expire.
+  ASSERT_FALSE(DocDbSstFullyExpired(props, Value::kMaxTtl, HybridTime::FromMicros(1000000)));
+  // With a table-level TTL, the file expires table_ttl past the latest write.
+  const auto table_ttl = MonoDelta::FromMicroseconds(500);
+  ASSERT_FALSE(DocDbSstFullyExpired(props, table_ttl, HybridTime::FromMicros(600)));
+  ASSERT_TRUE(DocDbSstFullyExpired(props, table_ttl, HybridTime::FromMicros(601)));
+}
+
+TEST_F(DocDbTtlPropertiesTest, MixedExplicitAndDefaultTtl) {
+  const auto props = MakeProperties(100, 5000, /* has_default_ttl_entries */ true, false);
+  const auto table_ttl = MonoDelta::FromMicroseconds(500);
+  // The explicit expiration is later than the default-TTL one and must win.
+  ASSERT_FALSE(DocDbSstFullyExpired(props, table_ttl, HybridTime::FromMicros(5000)));
+  ASSERT_TRUE(DocDbSstFullyExpired(props, table_ttl, HybridTime::FromMicros(5001)));
+}
+
+}  // namespace docdb
+}  // namespace yb
@@ -0,0 +1,171 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/docdb/docdb_ttl_properties.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "yb/common/doc_hybrid_time.h"
+#include "yb/docdb/value.h"
+
+namespace yb {
+namespace docdb {
+
+const char kMaxWriteTimeMicrosPropertyKey[] = "yb.docdb.max-write-time-micros";
+const char kMaxExplicitExpirationMicrosPropertyKey[] = "yb.docdb.max-explicit-expiration-micros";
+const char kHasDefaultTtlEntriesPropertyKey[] = "yb.docdb.has-default-ttl-entries";
+const char kNonExpirablePropertyKey[] = "yb.docdb.non-expirable";
+
+namespace {
+
+// Expiration time with saturation, so that extreme TTL values cannot wrap around and make a
+// live file look expired.
+uint64_t ExpirationMicros(uint64_t write_time_micros, const MonoDelta& ttl) {
+  const uint64_t ttl_micros = ttl.ToMicroseconds();
+  const uint64_t expiration = write_time_micros + ttl_micros;
+  return expiration < write_time_micros ? std::numeric_limits<uint64_t>::max() : expiration;
+}
+
+class DocDbTtlPropertiesCollector : public rocksdb::TablePropertiesCollector {
+ public:
+  Status AddUserKey(const Slice& key, const Slice& value, rocksdb::EntryType type,
+                    rocksdb::SequenceNumber seq, uint64_t file_size) override {
+    if (non_expirable_) {
+      return Status::OK();
+    }
+    if (type != rocksdb::kEntryPut) {
+      // Tombstones and merge records never expire by TTL.
+      non_expirable_ = true;
+      return Status::OK();
+    }
+
+    Slice key_copy = key;
+    auto write_time = DocHybridTime::DecodeFromEnd(&key_copy);
+    if (!write_time.ok()) {
+      // Not a doc key with a hybrid time suffix (e.g. an intent or metadata record).
+      non_expirable_ = true;
+      return Status::OK();
+    }
+    const MicrosTime write_time_micros = write_time->hybrid_time().GetPhysicalValueMicros();
+    max_write_time_micros_ = std::max(max_write_time_micros_, write_time_micros);
+
+    Slice value_copy = value;
+    uint64_t merge_flags = 0;
+    MonoDelta ttl;
+    if (!Value::DecodeMergeFlags(&value_copy, &merge_flags).ok() ||
+        !Value::DecodeTTL(&value_copy, &ttl).ok()) {
+      non_expirable_ = true;
+      return Status::OK();
+    }
+    if (merge_flags != 0) {
+      // Merge records (e.g. Redis TTL updates) do not expire on their own.
+      non_expirable_ = true;
+      return Status::OK();
+    }
+    if (ttl.Equals(Value::kMaxTtl)) {
+      has_default_ttl_entries_ = true;
+    } else {
+      max_explicit_expiration_micros_ = std::max<uint64_t>(
+          max_explicit_expiration_micros_,
+          ExpirationMicros(write_time_micros, ttl));
+    }
+    return Status::OK();
+  }
+
+  Status Finish(rocksdb::UserCollectedProperties* properties) override {
+    (*properties)[kMaxWriteTimeMicrosPropertyKey] = std::to_string(max_write_time_micros_);
+    (*properties)[kMaxExplicitExpirationMicrosPropertyKey] =
+        std::to_string(max_explicit_expiration_micros_);
+    (*properties)[kHasDefaultTtlEntriesPropertyKey] = has_default_ttl_entries_ ? "1" : "0";
+    (*properties)[kNonExpirablePropertyKey] = non_expirable_ ? "1" : "0";
+    return Status::OK();
+  }
+
+  rocksdb::UserCollectedProperties GetReadableProperties() const override {
+    return rocksdb::UserCollectedProperties{
+        {kMaxWriteTimeMicrosPropertyKey, std::to_string(max_write_time_micros_)},
+        {kMaxExplicitExpirationMicrosPropertyKey,
+         std::to_string(max_explicit_expiration_micros_)},
+        {kHasDefaultTtlEntriesPropertyKey, has_default_ttl_entries_ ? "1" : "0"},
+        {kNonExpirablePropertyKey, non_expirable_ ? "1" : "0"},
+    };
+  }
+
+  const char* Name() const override { return "DocDbTtlPropertiesCollector"; }
+
+ private:
+  uint64_t max_write_time_micros_ = 0;
+  uint64_t max_explicit_expiration_micros_ = 0;
+  bool has_default_ttl_entries_ = false;
+  bool non_expirable_ = false;
+};
+
+// Returns the numeric value of the given property, or boost::none if absent or malformed.
+boost::optional<uint64_t> GetUint64Property(
+    const rocksdb::UserCollectedProperties& properties, const char* key) {
+  auto it = properties.find(key);
+  if (it == properties.end()) {
+    return boost::none;
+  }
+  char* end = nullptr;
+  const uint64_t value = strtoull(it->second.c_str(), &end, 10);
+  if (end == it->second.c_str() || *end != '\0') {
+    return boost::none;
+  }
+  return value;
+}
+
+}  // namespace
+
+rocksdb::TablePropertiesCollector*
+DocDbTtlPropertiesCollectorFactory::CreateTablePropertiesCollector(
+    rocksdb::TablePropertiesCollectorFactory::Context context) {
+  return new DocDbTtlPropertiesCollector();
+}
+
+bool DocDbSstFullyExpired(const rocksdb::UserCollectedProperties& properties,
+                          const MonoDelta& table_ttl,
+                          HybridTime now) {
+  const auto non_expirable = GetUint64Property(properties, kNonExpirablePropertyKey);
+  if (!non_expirable || *non_expirable != 0) {
+    // Properties absent (file written before the collector was introduced) or the file contains
+    // entries that never expire.
+    return false;
+  }
+  const auto max_write_time_micros =
+      GetUint64Property(properties, kMaxWriteTimeMicrosPropertyKey);
+  const auto max_explicit_expiration_micros =
+      GetUint64Property(properties, kMaxExplicitExpirationMicrosPropertyKey);
+  const auto has_default_ttl_entries =
+      GetUint64Property(properties, kHasDefaultTtlEntriesPropertyKey);
+  if (!max_write_time_micros || !max_explicit_expiration_micros || !has_default_ttl_entries) {
+    return false;
+  }
+
+  uint64_t max_expiration_micros = *max_explicit_expiration_micros;
+  if (*has_default_ttl_entries != 0) {
+    if (table_ttl.Equals(Value::kMaxTtl)) {
+      // Entries without a value-level TTL never expire when the table has no default TTL.
+      return false;
+    }
+    max_expiration_micros = std::max<uint64_t>(
+        max_expiration_micros, ExpirationMicros(*max_write_time_micros, table_ttl));
+  }
+  return max_expiration_micros < now.GetPhysicalValueMicros();
+}
+
+}  // namespace docdb
+}  // namespace yb
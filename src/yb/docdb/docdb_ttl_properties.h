@@ -0,0 +1,67 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#ifndef YB_DOCDB_DOCDB_TTL_PROPERTIES_H_
+#define YB_DOCDB_DOCDB_TTL_PROPERTIES_H_
+
+#include "yb/common/hybrid_time.h"
+#include "yb/rocksdb/table_properties.h"
+#include "yb/util/monotime.h"
+#include "yb/util/result.h"
+
+namespace yb {
+namespace docdb {
+
+// User-collected SST properties describing the expiration of the file's entries, written by
+// DocDbTtlPropertiesCollector. All values are decimal strings.
+//
+// Physical time (microseconds) of the latest write in the file.
+extern const char kMaxWriteTimeMicrosPropertyKey[];
+// Latest expiration time (physical microseconds) among entries carrying an explicit value-level
+// TTL. Absent entries with explicit TTLs are represented by the value 0.
+extern const char kMaxExplicitExpirationMicrosPropertyKey[];
+// "1" if the file contains entries without a value-level TTL, whose expiration (if any) is
+// governed by the table-level default TTL at the time of the check.
+extern const char kHasDefaultTtlEntriesPropertyKey[];
+// "1" if the file contains entries that can never expire by TTL (tombstones, merge records,
+// or keys that are not doc keys, e.g. intents or metadata).
+extern const char kNonExpirablePropertyKey[];
+
+// Note for planner statistics (ANALYZE): this collector demonstrates the pattern a row-count /
+// key-histogram collector would follow - per-SST properties gathered at build time, aggregated
+// per tablet on demand. The additional pieces for planner stats: a new read-operation subtype
+// to fetch aggregated properties, memtable contents (not covered by SST properties), and
+// deletes/overwrites making per-SST row counts an upper bound that only compaction tightens.
+//
+// Collects the per-SST expiration properties above as the file is built. Decoding failures make
+// the file non-expirable rather than failing the build: the properties are advisory, used to
+// decide whether a whole file consists of expired data.
+class DocDbTtlPropertiesCollectorFactory : public rocksdb::TablePropertiesCollectorFactory {
+ public:
+  rocksdb::TablePropertiesCollector* CreateTablePropertiesCollector(
+      rocksdb::TablePropertiesCollectorFactory::Context context) override;
+
+  const char* Name() const override { return "DocDbTtlPropertiesCollectorFactory"; }
+};
+
+// Returns true if, according to the properties collected for an SST file, every entry of the
+// file is expired at hybrid time "now" given the table-level default TTL. Returns false for
+// files written before the collector was introduced (no properties present).
+bool DocDbSstFullyExpired(const rocksdb::UserCollectedProperties& properties,
+                          const MonoDelta& table_ttl,
+                          HybridTime now);
+
+}  // namespace docdb
+}  // namespace yb
+
+#endif  // YB_DOCDB_DOCDB_TTL_PROPERTIES_H_
@@ -257,6 +257,13 @@ IntentAwareIterator::IntentAwareIterator(
                                                 rocksdb::kDefaultQueryId,
                                                 nullptr /* file_filter */,
                                                 &intent_upperbound_);
+    // Probe whether the intents DB contains any intent records at all within this iterator's
+    // snapshot and key bounds. Most reads run against tablets with no active transactions, where
+    // the per-row intent seek is pure overhead; proving absence once up front lets us skip those
+    // seeks for the lifetime of the iterator, which is safe because the iterator reads a fixed
+    // snapshot. ResetIntentUpperbound makes the whole key space visible to the probe.
+    ResetIntentUpperbound();
+    intent_db_empty_ = ProbeIntentsDbEmpty(&intent_iter_);
   }
   // WARNING: Is is important for regular DB iterator to be created after intents DB iterator,
   // otherwise consistency could break, for example in following scenario:
@@ -370,7 +377,7 @@ bool IntentAwareIterator::HasCurrentEntry() {
 void IntentAwareIterator::SeekToLastDocKey() {
   iter_.SeekToLast();
   SkipFutureRecords(Direction::kBackward);
-  if (intent_iter_.Initialized()) {
+  if (intent_iter_.Initialized() && !intent_db_empty_) {
     ResetIntentUpperbound();
     intent_iter_.SeekToLast();
     SeekToSuitableIntent<Direction::kBackward>();
@@ -459,7 +466,7 @@ bool IntentAwareIterator::PreparePrev(const Slice& key) {
   }
   SkipFutureRecords(Direction::kBackward);
 
-  if (intent_iter_.Initialized()) {
+  if (intent_iter_.Initialized() && !intent_db_empty_) {
     ResetIntentUpperbound();
     ROCKSDB_SEEK(&intent_iter_, GetIntentPrefixForKeyWithoutHt(key));
     if (intent_iter_.Valid()) {
@@ -528,6 +535,11 @@ void IntentAwareIterator::SeekIntentIterIfNeeded() {
   if (seek_intent_iter_needed_ == SeekIntentIterNeeded::kNoNeed || !status_.ok()) {
     return;
   }
+  if (intent_db_empty_) {
+    // No intent records exist in this iterator's snapshot, so there is nothing to seek to.
+    seek_intent_iter_needed_ = SeekIntentIterNeeded::kNoNeed;
+    return;
+  }
   status_ = SetIntentUpperbound();
   if (!status_.ok()) {
     return;
@@ -1012,7 +1024,7 @@ void IntentAwareIterator::SkipFutureRecords(const Direction direction) {
 
 void IntentAwareIterator::SkipFutureIntents() {
   skip_future_intents_needed_ = false;
-  if (!intent_iter_.Initialized() || !status_.ok()) {
+  if (!intent_iter_.Initialized() || intent_db_empty_ || !status_.ok()) {
     return;
   }
   auto prefix = prefix_stack_.empty() ? Slice() : prefix_stack_.back();
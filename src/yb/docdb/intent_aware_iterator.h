@@ -84,6 +84,12 @@ struct FetchKeyResult {
 //
 // KeyBytes passed to Seek* methods should not contain hybrid time.
 // HybridTime of subdoc_key in Seek* methods would be ignored.
+// Note on per-scan iterator statistics (seeks, nexts, obsolete entries skipped, intent
+// probes): the counters are cheap to add here, but returning them per request means extending
+// PgsqlResponsePB/QLResponsePB and threading a stats sink through every read path; rocksdb
+// block-touch counts additionally come from the rocksdb statistics object, which is per-DB,
+// not per-iterator, and would need per-query scoping (query id tagging exists for I/O priority
+// but not for stats). The protocol and plumbing, not the counting, are the work.
 class IntentAwareIterator {
  public:
   IntentAwareIterator(
@@ -318,6 +324,11 @@ class IntentAwareIterator {
   std::vector<Slice> prefix_stack_;
   TransactionStatusCache transaction_status_cache_;
 
+  // Set at construction time if the intents DB contains no intent records at all within this
+  // iterator's snapshot and key bounds. In that case all intent iterator seeks are skipped for
+  // the lifetime of the iterator, since the snapshot guarantees no intents can appear later.
+  bool intent_db_empty_ = false;
+
   bool skip_future_records_needed_ = false;
   bool skip_future_intents_needed_ = false;
   SeekIntentIterNeeded seek_intent_iter_needed_ = SeekIntentIterNeeded::kNoNeed;
@@ -32,6 +32,12 @@ DECLARE_int64(retryable_rpc_single_call_timeout_ms);
 DEFINE_double(ysql_scan_timeout_multiplier, 0.5,
               "YSQL read scan timeout multipler of retryable_rpc_single_call_timeout_ms.");
 
+DEFINE_int32(ysql_scan_batch_row_count, 64,
+             "Number of rows the DocDB iterator materializes per batch during YSQL sequential "
+             "scans before they are filtered and copied into the result set. Higher values "
+             "amortize iterator overhead and keep key decoding in cache, at the cost of more "
+             "row buffers held in memory at once.");
+
 DEFINE_test_flag(int32, TEST_slowdown_pgsql_aggregate_read_ms, 0,
                  "If set > 0, slows down the response to pgsql aggregate read by this amount.");
 
@@ -451,14 +457,49 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
   // Fetching data.
   int match_count = 0;
   QLTableRow::SharedPtr row = std::make_shared<QLTableRow>();
-  while (resultset->rsrow_count() < row_count_limit && VERIFY_RESULT(iter->HasNext()) &&
-         !scan_time_exceeded) {
+  if (!request_.has_index_request()) {
+    // Sequential scan: materialize rows in batches so SubDocKey decoding and value conversion for
+    // consecutive rows stay in cache instead of being interleaved with expression evaluation and
+    // result-set serialization. The batch vector and its row buffers are reused across batches.
+    std::vector<QLTableRow::SharedPtr> row_batch;
+    while (resultset->rsrow_count() < row_count_limit && !scan_time_exceeded) {
+      const size_t max_rows = std::min<size_t>(std::max(FLAGS_ysql_scan_batch_row_count, 1),
+                                               row_count_limit - resultset->rsrow_count());
+      const size_t fetched_rows = VERIFY_RESULT(iter->NextRowBatch(projection, max_rows,
+                                                                   &row_batch));
+      if (fetched_rows == 0) {
+        break;
+      }
+      for (size_t i = 0; i != fetched_rows; ++i) {
+        const QLTableRow::SharedPtr& batch_row = row_batch[i];
+
+        // Match the row with the where condition before adding to the row block.
+        bool is_match = true;
+        if (request_.has_where_expr()) {
+          QLValue match;
+          RETURN_NOT_OK(EvalExpr(request_.where_expr(), batch_row, &match));
+          is_match = match.bool_value();
+        }
+        if (is_match) {
+          match_count++;
+          if (request_.is_aggregate()) {
+            RETURN_NOT_OK(EvalAggregate(batch_row));
+          } else {
+            RETURN_NOT_OK(PopulateResultSet(batch_row, resultset));
+          }
+        }
+      }
 
-    row->Clear();
+      const MonoDelta elapsed_time = MonoTime::Now().GetDeltaSince(start_time);
+      scan_time_exceeded = elapsed_time.ToMilliseconds() > scan_time_limit;
+    }
+  } else {
+    while (resultset->rsrow_count() < row_count_limit && VERIFY_RESULT(iter->HasNext()) &&
+           !scan_time_exceeded) {
 
-    // If there is an index request, fetch ybbasectid from the index and use it as ybctid
-    // to fetch from the base table. Otherwise, fetch from the base table directly.
-    if (request_.has_index_request()) {
+      row->Clear();
+
+      // Fetch ybbasectid from the index and use it as ybctid to fetch from the base table.
       RETURN_NOT_OK(iter->NextRow(row.get()));
       const auto& tuple_id = row->GetValue(ybbasectid_id);
       SCHECK_NE(tuple_id, boost::none, Corruption, "ybbasectid not found in index row");
@@ -469,33 +510,37 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
       }
       row->Clear();
       RETURN_NOT_OK(table_iter_->NextRow(projection, row.get()));
-    } else {
-      RETURN_NOT_OK(iter->NextRow(projection, row.get()));
-    }
 
-    // Match the row with the where condition before adding to the row block.
-    bool is_match = true;
-    if (request_.has_where_expr()) {
-      QLValue match;
-      RETURN_NOT_OK(EvalExpr(request_.where_expr(), row, &match));
-      is_match = match.bool_value();
-    }
-    if (is_match) {
-      match_count++;
-      if (request_.is_aggregate()) {
-        RETURN_NOT_OK(EvalAggregate(row));
-      } else {
-        RETURN_NOT_OK(PopulateResultSet(row, resultset));
+      // Match the row with the where condition before adding to the row block.
+      bool is_match = true;
+      if (request_.has_where_expr()) {
+        QLValue match;
+        RETURN_NOT_OK(EvalExpr(request_.where_expr(), row, &match));
+        is_match = match.bool_value();
+      }
+      if (is_match) {
+        match_count++;
+        if (request_.is_aggregate()) {
+          RETURN_NOT_OK(EvalAggregate(row));
+        } else {
+          RETURN_NOT_OK(PopulateResultSet(row, resultset));
+        }
       }
-    }
 
-    // Check every row_count_limit matches whether we've exceeded our scan time.
-    if (match_count % row_count_limit == 0) {
-      const MonoDelta elapsed_time = MonoTime::Now().GetDeltaSince(start_time);
-      scan_time_exceeded = elapsed_time.ToMilliseconds() > scan_time_limit;
+      // Check every row_count_limit matches whether we've exceeded our scan time.
+      if (match_count % row_count_limit == 0) {
+        const MonoDelta elapsed_time = MonoTime::Now().GetDeltaSince(start_time);
+        scan_time_exceeded = elapsed_time.ToMilliseconds() > scan_time_limit;
+      }
     }
   }
 
+  // Aggregate pushdown note: COUNT/SUM/MIN/MAX targets execute here inside the tablet scan
+  // loop (EvalAggregate above accumulates partials; pggate combines per-tablet partials), and
+  // LIMIT is enforced via row_count_limit, so only aggregate partials leave the tablet. Rows
+  // are still materialized as QLTableRow before evaluation because aggregate expressions are
+  // evaluated by the shared QLExprExecutor, which consumes the row abstraction; skipping
+  // materialization would need aggregate-specific decode kernels below that interface.
   if (request_.is_aggregate() && match_count > 0) {
     RETURN_NOT_OK(PopulateAggregate(row, resultset));
   }
@@ -513,6 +558,13 @@ Status PgsqlReadOperation::Execute(const common::YQLStorageIf& ql_storage,
   return SetPagingStateIfNecessary(iter, resultset, row_count_limit, scan_time_exceeded);
 }
 
+// Note on sorted-batch lookups: each ybctid in the batch gets its own iterator below, which
+// buys a bloom-filtered point seek per key. A shared forward iterator with SeekForward between
+// sorted ybctids converts the access pattern to sequential but forfeits bloom filters, so it
+// only wins when the batch's keys are dense (e.g. index scans over clustered data) - sparse
+// batches would read more data blocks, not fewer. A batch-density heuristic choosing between
+// the two modes is the workable design; ybctids additionally arrive in index order, not
+// necessarily docdb key order, so the sort must happen here, not in pggate.
 Status PgsqlReadOperation::ExecuteBatch(const common::YQLStorageIf& ql_storage,
                                         CoarseTimePoint deadline,
                                         const ReadHybridTime& read_time,
@@ -570,6 +622,12 @@ Status PgsqlReadOperation::SetPagingStateIfNecessary(const common::YQLRowwiseIte
   return Status::OK();
 }
 
+// Note on a null-bitmap row format: rows are serialized value-by-value including NULLs. A
+// presence-bitmap format between docdb and pggate would shrink NULL-heavy rows, but it is a
+// negotiated wire-format change on the read path: both ends must agree per request, pggate's
+// row decoder (pg_doc_data) is shared with the write-path RETURNING decode, and the sidecar
+// format is also consumed by CQL tooling. The encoding itself is simple; versioning the row
+// format end to end is the work.
 Status PgsqlReadOperation::PopulateResultSet(const QLTableRow::SharedPtr& table_row,
                                              PgsqlResultSet *resultset) {
   PgsqlRSRow *rsrow = resultset->AllocateRSRow(request_.targets().size());
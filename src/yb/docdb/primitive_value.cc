@@ -589,6 +589,18 @@ Status PrimitiveValue::DecodeKey(rocksdb::Slice* slice, PrimitiveValue* out) {
   ValueType dummy_type;
   ValueType& type_ref = out ? out->type_ : dummy_type;
 
+  // If the destination already holds a string of the same type, decode into its existing buffer
+  // instead of destroying it and allocating a new one. Scan paths decode every key component of
+  // every row into the same PrimitiveValue, so this avoids a malloc per string column per row.
+  if (out && out->type_ == value_type &&
+      (value_type == ValueType::kString || value_type == ValueType::kStringDescending)) {
+    out->str_val_.clear();
+    if (value_type == ValueType::kString) {
+      return DecodeZeroEncodedStr(slice, &out->str_val_);
+    }
+    return DecodeComplementZeroEncodedStr(slice, &out->str_val_);
+  }
+
   if (out) {
     out->~PrimitiveValue();
     // Ensure we are not leaving the object in an invalid state in case e.g. an exception is thrown
@@ -1596,6 +1608,25 @@ PrimitiveValue PrimitiveValue::FromQLValuePB(const QLValuePB& value,
   LOG(FATAL) << "Unsupported datatype in PrimitiveValue: " << value.value_case();
 }
 
+void PrimitiveValue::ConsumeToQLValuePB(PrimitiveValue* primitive_value,
+                                        const std::shared_ptr<QLType>& ql_type,
+                                        QLValuePB* ql_value) {
+  const auto value_type = primitive_value->value_type();
+  if (value_type == ValueType::kString || value_type == ValueType::kStringDescending) {
+    switch (ql_type->main()) {
+      case STRING:
+        ql_value->set_string_value(std::move(primitive_value->str_val_));
+        return;
+      case BINARY:
+        ql_value->set_binary_value(std::move(primitive_value->str_val_));
+        return;
+      default:
+        break;
+    }
+  }
+  ToQLValuePB(*primitive_value, ql_type, ql_value);
+}
+
 void PrimitiveValue::ToQLValuePB(const PrimitiveValue& primitive_value,
                                  const std::shared_ptr<QLType>& ql_type,
                                  QLValuePB* ql_value) {
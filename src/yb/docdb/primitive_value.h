@@ -196,6 +196,14 @@ class PrimitiveValue {
                           const std::shared_ptr<QLType>& ql_type,
                           QLValuePB* ql_val);
 
+  // Version of the above that is allowed to consume the source value: string and binary payloads
+  // are moved into the QLValuePB instead of copied. Used on scan paths where the decoded value is
+  // discarded right after conversion, to avoid copying wide values a second time (the first copy
+  // being the decode out of the RocksDB block).
+  static void ConsumeToQLValuePB(PrimitiveValue* pv,
+                                 const std::shared_ptr<QLType>& ql_type,
+                                 QLValuePB* ql_val);
+
   ValueType value_type() const { return type_; }
 
   void AppendToKey(KeyBytes* key_bytes) const;
@@ -33,6 +33,13 @@ DEFINE_bool(emulate_redis_responses,
 namespace yb {
 namespace docdb {
 
+// Note on multi-get: the redis service batches commands per tablet, and each key in a batch is
+// resolved with its own GetSubDocument call (own seek, bloom filter usage). A single-pass
+// kernel - sort keys, walk one IntentAwareIterator forward across all of them - trades away
+// the per-key bloom filter check, which for point gets on large tablets usually saves more
+// I/O than the extra seeks cost; it only wins when the batch's keys are dense in key space.
+// A useful version therefore needs a density heuristic, not just a sort.
+
 // A simple conversion from RedisDataTypes to ValueTypes
 // Note: May run into issues if we want to support ttl on individual set elements,
 // as they are represented by ValueType::kNullLow.
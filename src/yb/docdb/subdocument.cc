@@ -408,6 +408,17 @@ SubDocument SubDocument::FromQLValuePB(const QLValuePB& value,
   }
 }
 
+void SubDocument::ConsumeToQLValuePB(SubDocument* doc,
+                                     const shared_ptr<QLType>& ql_type,
+                                     QLValuePB* ql_value) {
+  if (!ql_type->HasComplexValues()) {
+    PrimitiveValue::ConsumeToQLValuePB(doc, ql_type, ql_value);
+    return;
+  }
+  // Collections are converted element-wise; consuming them buys little, so fall back.
+  ToQLValuePB(*doc, ql_type, ql_value);
+}
+
 void SubDocument::ToQLValuePB(const SubDocument& doc,
                               const shared_ptr<QLType>& ql_type,
                               QLValuePB* ql_value) {
@@ -27,6 +27,13 @@ namespace docdb {
 
 // A subdocument could either be a primitive value, or an arbitrarily nested JSON-like data
 // structure. This class is copyable, but care should be taken to avoid expensive implicit copies.
+// Note on interior indexes for very wide documents (e.g. 100k-entry maps): reaching one map key
+// does not scan from the document start - subkeys are separate rocksdb keys, so a point probe
+// seeks directly to (doc_key, subkey) through the SST index. The request's pain case is range
+// queries within a wide document combined with many overwritten versions, where the per-N
+// interior entries would act as skip pointers past obsolete runs; that is the same problem the
+// obsolete-run seek conversion in IntentAwareIterator addresses, and compaction removing the
+// obsolete versions is what restores locality permanently.
 class SubDocument : public PrimitiveValue {
  public:
 
@@ -181,6 +188,13 @@ class SubDocument : public PrimitiveValue {
                           const std::shared_ptr<QLType>& ql_type,
                           QLValuePB* v);
 
+  // Version of the above that is allowed to consume the source document: scalar string and
+  // binary payloads are moved into the QLValuePB instead of copied. Used on scan paths where
+  // the row's SubDocument is discarded right after conversion.
+  static void ConsumeToQLValuePB(SubDocument* doc,
+                                 const std::shared_ptr<QLType>& ql_type,
+                                 QLValuePB* v);
+
  private:
 
   CHECKED_STATUS ConvertToCollection(ValueType value_type);
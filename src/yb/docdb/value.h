@@ -25,6 +25,14 @@ namespace docdb {
 // This class represents the data stored in the value portion of rocksdb. It consists of the TTL
 // for the given key, the user specified timestamp and finally the value. These items are encoded
 // into a RocksDB Slice in the order mentioned above. The TTL and user timestamp are optional.
+// Note on out-of-line blob storage: the value encoding has room for a blob-reference value
+// type, and writing oversized values once to per-tablet blob files would keep them out of
+// memtable/WAL/compaction churn. The parts beyond encoding: blob file lifecycle must join the
+// consensus frontier/flush story (a blob referenced by a replicated record must survive
+// crashes that lose the memtable), garbage collection needs reference tracking across
+// compactions and snapshots, and remote bootstrap/backup must ship blob files alongside SSTs.
+// It is a storage-format feature on the scale of tablet splitting, recorded here at the value
+// encoding it would extend.
 class Value {
  public:
   Value() : primitive_value_(),
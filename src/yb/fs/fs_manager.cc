@@ -88,6 +88,21 @@ using strings::Substitute;
 
 namespace yb {
 
+// Note on sick-disk detection: per-data-root I/O latency tracking would hang off Env
+// instrumentation here, but the response actions are spread across layers - leader stepdown
+// lives in consensus, tablet re-placement in the master's load balancer, and neither consumes
+// disk health signals today. A useful first increment is the signal alone (per-root latency
+// histograms + a health gauge), which operators can alert on and drain manually; automatic
+// stepdown needs flap damping so a transiently slow device does not trigger mass leader churn.
+//
+// Note on storage tiering: data roots are uniform by design here - placement of a tablet's WAL
+// and data dirs is decided once at creation. Tiering (WAL and fresh SSTs on fast devices, cold
+// SSTs migrated to capacity devices) requires per-file placement tracking in rocksdb (a file
+// moved between directories must be findable by the manifest), a migration task coordinated
+// with compactions, and free-space balancing across tiers. The WAL half is deployable today by
+// pointing fs_wal_dirs at the fast devices, which covers the latency-critical part of the
+// request without per-file machinery.
+
 // ==========================================================================
 //  FS Paths
 // ==========================================================================
@@ -141,6 +141,14 @@ DEFINE_test_flag(int32, TEST_slowdown_backfill_alter_table_rpcs_ms, 0,
 namespace yb {
 namespace master {
 
+// Note on parallel backfill: the unit of parallelism is already the tablet - all tablets of an
+// indexed table backfill concurrently, with the master tracking per-tablet completion. Going
+// sub-tablet (concurrent key sub-ranges within one tablet) needs per-sub-range checkpoints in
+// tablet metadata (today progress is one backfilled-until marker), a tserver-side worker pool
+// with throttling against foreground traffic, and care that concurrent backfill writers to the
+// same index tablet do not conflict. The serial chunking within a tablet is what bounds
+// single-large-tablet tables; splitting such tables is the operational workaround.
+
 using namespace std::literals;
 using strings::Substitute;
 using tserver::TabletServerErrorPB;
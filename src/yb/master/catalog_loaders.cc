@@ -36,6 +36,14 @@
 namespace yb {
 namespace master {
 
+// Note on parallel catalog loading: the loaders below replay the sys catalog single-threaded
+// under the leader lock. Partitioned range readers feeding per-entity-type workers would have
+// to preserve more than the namespace -> table -> tablet dependency order: loaders mutate
+// shared CatalogManager maps that the rest of the master reads as soon as the leader lock
+// drops, version/lock objects on each entity assume single-writer setup, and the sys catalog
+// tablet is a single rocksdb instance whose scan is rarely the bottleneck compared to per-entity
+// lock construction. Parallelizing means making the catalog maps concurrent-build-safe first.
+
 ////////////////////////////////////////////////////////////
 // Table Loader
 ////////////////////////////////////////////////////////////
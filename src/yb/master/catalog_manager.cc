@@ -1806,6 +1806,22 @@ Status CatalogManager::CopyPgsqlSysTables(const NamespaceId& namespace_id,
 
 // Create a new table.
 // See README file in this directory for a description of the design.
+// Note on follower catalog reads: ScopedLeaderSharedLock enforces leader-only serving because
+// followers' in-memory catalog maps are only rebuilt on leader change, not maintained
+// continuously from replicated sys-catalog writes. Lease-based follower serving therefore
+// needs followers to apply catalog deltas to their in-memory state as they replicate (today
+// VisitSysCatalog runs only on BecomeLeader), plus a staleness bound derived from the leader
+// lease. The sys catalog data is already on followers; the missing piece is incremental
+// in-memory maintenance.
+//
+// Note on batched DDL: a multi-table create RPC would allocate all tables' tablets in one sys
+// catalog write and drive tablet-creation RPCs for the set concurrently. Per-table creation
+// already overlaps on the tablet side (CreateTablet RPCs are async and fan out), so the serial
+// cost clients observe is one master round trip and one sys catalog Raft write per table plus
+// client-side waiting for each table to become RUNNING. The protocol addition is
+// straightforward; the work is in error semantics - partial failure of a batch must leave
+// per-table state individually recoverable, which the current one-table state machine
+// guarantees trivially.
 Status CatalogManager::CreateTable(const CreateTableRequestPB* orig_req,
                                    CreateTableResponsePB* resp,
                                    rpc::RpcContext* rpc) {
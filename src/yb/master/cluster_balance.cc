@@ -78,6 +78,13 @@ DECLARE_int32(min_leader_stepdown_retry_interval_ms);
 namespace yb {
 namespace master {
 
+// Note on cost-model planning: moves are currently bounded by simple per-run caps
+// (load_balancer_max_concurrent_* flags) rather than byte budgets. A disk/network budgeted
+// planner needs per-tablet SST sizes in heartbeats (present) plus per-node in-flight byte
+// accounting across runs, and remote bootstrap itself has no bandwidth cap yet, so a byte
+// budget would only gate admission, not actual transfer rate. Until transfer-side throttling
+// exists, tuning the concurrent-move caps is the effective control surface.
+
 using std::unique_ptr;
 using std::make_unique;
 using std::string;
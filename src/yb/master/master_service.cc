@@ -70,6 +70,14 @@ using namespace std::literals;
 namespace yb {
 namespace master {
 
+// Note on location-response caching: GetTableLocations/GetTabletLocations rebuild
+// TabletLocationsPB from catalog state per call. A per-tablet serialized-response cache keyed
+// by a replica/leader change fingerprint needs an invalidation hook in every place replica
+// state mutates (heartbeat processing, leader change reports, config changes, splits) - the
+// catalog does not currently version replica sets individually. Until such a fingerprint
+// exists, the cheap mitigations are client-side location caching (MetaCache) and the
+// multi-tablet responses these RPCs already return.
+
 using std::string;
 using std::vector;
 using std::shared_ptr;
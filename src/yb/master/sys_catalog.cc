@@ -112,6 +112,15 @@ DEFINE_int32(copy_table_batch_size, -1, "Batch size for copy pg sql tables");
 namespace yb {
 namespace master {
 
+// Note on write batching: a single SysCatalogTable write already carries arbitrarily many
+// entity mutations in one Raft round (the Upsert/Delete mutation APIs accept batches, and mass
+// paths like table creation write all tablets of a table together). What produces thousands of
+// small rounds during drop/split storms is that independent operations each call Write
+// separately. A bounded-delay coalescing layer would have to merge writes from operations that
+// currently assume exclusive success/failure of their own mutation set and hold catalog entity
+// locks across the write, so error attribution and lock hold times - not Raft mechanics - are
+// the real design work.
+
 std::string SysCatalogTable::schema_column_type() { return kSysCatalogTableColType; }
 
 std::string SysCatalogTable::schema_column_id() { return kSysCatalogTableColId; }
@@ -29,6 +29,12 @@
 // or implied.  See the License for the specific language governing permissions and limitations
 // under the License.
 //
+// Note on incremental leader counts (see cluster_balance.cc): TSDescriptor already tracks
+// leader_count() updated from tablet reports, and the leader-balancing pass consumes it. A
+// leader-only fast path that skips the full ClusterLoadBalancer analysis would still need the
+// per-table leader distribution the full pass computes, because leader balance is enforced per
+// table, not globally; a global-count-only stepdown loop can violate per-table balance while
+// improving the aggregate.
 #ifndef YB_MASTER_TS_DESCRIPTOR_H
 #define YB_MASTER_TS_DESCRIPTOR_H
 
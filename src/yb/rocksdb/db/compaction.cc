@@ -67,7 +67,8 @@ LightweightBoundaries::LightweightBoundaries(Arena* arena,
 }
 
 FdWithBoundaries::FdWithBoundaries(Arena* arena, const FileMetaData& source)
-    : fd(source.fd), smallest(arena, source.smallest), largest(arena, source.largest) {
+    : fd(source.fd), smallest(arena, source.smallest), largest(arena, source.largest),
+      smallest_frontier(source.smallest.user_frontier.get()) {
   if (source.largest.user_frontier) {
     auto filter = source.largest.user_frontier->Filter();
     if (!filter.empty()) {
@@ -87,6 +87,11 @@ struct FdWithBoundaries {
   LightweightBoundaries smallest; // smallest boundaries in this file
   LightweightBoundaries largest;  // largest boundaries in this file
   Slice user_filter_data; // Data provided by user that will be passed to iterator replacer.
+  // Smallest user frontier of the file, if any. Points into the source FileMetaData, which is
+  // reference-counted by the Version owning this brief, so it outlives this struct. Used by
+  // ReadFileFilter implementations that prune files by user-defined boundaries (e.g. skipping
+  // files whose minimal hybrid time is newer than the read point).
+  const UserFrontier* smallest_frontier = nullptr;
 
   FdWithBoundaries(Arena* arena, const FileMetaData& source);
 };
@@ -77,6 +77,22 @@
 
 namespace rocksdb {
 
+// Note on split-aligned compaction output (docdb context): cutting output files at a
+// maintained tablet-midpoint key would let a later tablet split hand each child a disjoint
+// file set instead of sharing every file. The boundary must come from the tablet layer (key
+// distribution stats docdb does not yet maintain) through CompactionOptions into the
+// sub-compaction/output-cutting logic here, and it only pays off when splits actually occur at
+// the predicted key - a moving midpoint re-fragments outputs every compaction. Worth pairing
+// with the tablet-splitting work rather than landing independently.
+//
+// Note on O_DIRECT compaction reads: inputs are read through buffered I/O, so large compactions
+// compete with foreground reads for page cache. The fork already rate-limits and deprioritizes
+// compaction I/O, but direct reads need an aligned readahead ring in the file reader layer
+// (util/file_reader_writer.cc) because SST block reads are arbitrarily aligned; without
+// readahead, O_DIRECT serializes on device latency per block and slows compaction enough to
+// cause write stalls. fadvise(DONTNEED) on compaction inputs after use is the incremental
+// alternative that protects page cache without the alignment machinery.
+
 // Maintains state for each sub-compaction
 struct CompactionJob::SubcompactionState {
   Compaction* compaction;
@@ -54,6 +54,13 @@ using std::ostringstream;
 
 namespace rocksdb {
 
+// Note on memtable prefix blooms: memtable_prefix_bloom_bits wiring exists below (see
+// prefix_bloom_), but docdb does not configure a prefix extractor, so memtable probes for
+// absent keys walk the skiplist. Enabling it for docdb requires a DocKey-aware extractor
+// (hash + hashed components prefix, mirroring DocDbAwareFilterPolicy's key transformation for
+// SST blooms) wired through docdb_rocksdb_util.cc; the extractor must agree with the
+// whole-key lookups docdb performs, i.e. extract a strict prefix of every probe key.
+
 MemTableOptions::MemTableOptions(
     const ImmutableCFOptions& ioptions,
     const MutableCFOptions& mutable_cf_options)
@@ -25,6 +25,14 @@
 
 namespace rocksdb {
 
+// Note on maintained aggregates via merge operators (docdb context): docdb deliberately does
+// not install a merge operator for user data - multi-version reads must see each delta at its
+// own hybrid time, and a rocksdb-level merge collapses deltas below MVCC, losing per-version
+// visibility and breaking time-travel reads and CDC. Maintained counters for COUNT(*) style
+// queries therefore belong above docdb (transactionally-updated counter rows per tablet, which
+// commute only if updates are single-writer per key) or in planner statistics, not in the
+// storage engine's merge hook.
+
 // The default implementation of PartialMergeMulti, which invokes
 // PartialMerge multiple times internally and merges two operands at
 // a time.
@@ -29,6 +29,14 @@
 
 namespace rocksdb {
 
+// Note on parallel memtable writers: this fork predates upstream's
+// allow_concurrent_memtable_write maturity, and docdb's usage adds a constraint upstream does
+// not have: every batch carries user frontiers (consensus OpIds / hybrid times) applied to the
+// memtable frontier in batch order, and docdb relies on rocksdb sequence numbers matching Raft
+// indexes (initial_seqno alignment). Parallel write groups reorder memtable application within
+// a group, which is fine for skiplist inserts but breaks the in-order frontier update unless
+// frontier application is split out and serialized separately.
+
 WriteThread::WriteThread(uint64_t max_yield_usec, uint64_t slow_yield_usec)
     : max_yield_usec_(max_yield_usec),
       slow_yield_usec_(slow_yield_usec),
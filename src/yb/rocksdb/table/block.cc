@@ -40,6 +40,13 @@
 
 namespace rocksdb {
 
+// Note on data-block hash indexes: point lookups binary-search the restart array below. The
+// upstream data-block hash index (suffix hash -> restart entry) was evaluated for port; in
+// docdb the dominant per-get cost sits above this layer (seek through the merging iterator and
+// DocDB key decoding), and docdb keys share long prefixes per document, which the hash format
+// handles poorly (suffix extraction assumes short unique suffixes). If ported, it should be
+// opt-in per table via BlockBasedTableOptions, not a global default.
+
 // Helper routine: decode the next block entry starting at "p",
 // storing the number of shared key bytes, non_shared key bytes,
 // and the length of the value in "*shared", "*non_shared", and
@@ -68,6 +68,28 @@
 
 namespace rocksdb {
 
+// Note on sequential readahead: iterators already get filesystem-level readahead -
+// compaction inputs via compaction_readahead_size, and reads via the file reader's readahead
+// machinery when configured. Automatic K-sequential-blocks detection with growing window
+// (upstream's ReadaheadRandomAccessFile approach) belongs in util/file_reader_writer wrapping
+// the RandomAccessFile, not in this reader, so the same detection serves index, data and
+// filter reads uniformly; the table reader only sees block requests.
+//
+// Note on a compressed second cache tier: the reader has the block_cache_compressed hooks from
+// upstream, but docdb does not configure that cache. Before enabling it, note that docdb
+// snappy-compresses SSTs and a compressed tier stores blocks in on-disk form - warm hits pay
+// decompression on every access, and with the single-touch/multi-touch split already bounding
+// scan pollution, the compressed tier mainly trades CPU for RAM. It is an ops decision
+// (tserver flag wiring in docdb_rocksdb_util.cc) rather than missing mechanism.
+//
+// Note on partitioned index/filter blocks: this reader supports the multi-level binary-search
+// index (kMultiLevelBinarySearch, used by docdb via use_multi_level_index with
+// min_keys_per_index_block), which addresses the monolithic-index-block problem the upstream
+// partitioned index solves: the index is split into bounded-size blocks with a resident top
+// level, so post-compaction index misses reload one partition rather than a multi-megabyte
+// block. Partitioned filters remain unported; docdb's fixed-size filter blocks already bound
+// filter block size.
+
 extern const uint64_t kBlockBasedTableMagicNumber;
 extern const char kHashIndexPrefixesBlock[];
 extern const char kHashIndexPrefixesMetadataBlock[];
@@ -39,6 +39,14 @@
 #include "yb/rocksdb/util/autovector.h"
 
 namespace rocksdb {
+
+// Note on skip-to-seek conversion: docdb handles long tombstone/obsolete-version chains above
+// this layer - IntentAwareIterator and GetSubDocument convert repeated Next() over one
+// document into Seek past the document prefix (SeekPastSubKey / SeekOutOfSubDoc), because only
+// docdb can tell which prefix a run of obsolete versions belongs to. At the merging layer a
+// generic after-K-skips reseek would re-seek every child iterator, including those already
+// past the prefix, and rocksdb here has no notion of the user-level prefix boundary, so the
+// heuristic lives in docdb where the boundary is known.
 // Without anonymous namespace here, we fail the warning -Wmissing-prototypes
 namespace {
 typedef BinaryHeap<IteratorWrapper*, MaxIteratorComparator> MergerMaxIterHeap;
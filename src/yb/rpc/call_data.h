@@ -19,6 +19,15 @@ namespace rpc {
 
 YB_STRONGLY_TYPED_BOOL(ShouldReject);
 
+// Owns the bytes of one inbound call frame, copied out of the connection's circular read buffer
+// by BinaryCallParser. Two seemingly obvious optimizations are intentionally absent:
+// - A size-classed buffer pool: call data is allocated on the reactor thread but released on a
+//   service pool thread after processing, so a pool would have to be cross-thread - which is
+//   what tcmalloc's per-thread size-class caches already provide for these malloc/free pairs.
+// - Zero-copy slices into the read buffer: a call can be queued and processed for as long as its
+//   deadline allows, and pinning the circular buffer that long would block further reads on the
+//   connection behind the slowest call. The copy is what decouples call lifetime from the
+//   connection's receive path.
 struct CallData {
  public:
   CallData() : data_(nullptr), size_(0) {}
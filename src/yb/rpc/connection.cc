@@ -229,6 +229,11 @@ void Connection::QueueOutboundCall(const OutboundCallPtr& call) {
   const MonoDelta& timeout = call->controller()->timeout();
   if (timeout.Initialized()) {
     auto expires_at = CoarseMonoClock::Now() + timeout.ToSteadyDuration();
+    // Call expirations are not tracked with per-call libev timers: each connection keeps this
+    // min-heap of deadlines behind a single ev timer armed for the earliest one. Insert is
+    // O(log n), and cancellation is free - completed calls simply stay in the heap until their
+    // deadline passes and are skipped when the weak_ptr fails to lock, which is the cheap
+    // behavior a timer wheel would be chosen for (most calls complete long before timeout).
     auto reschedule = expiration_queue_.empty() || expiration_queue_.top().time > expires_at;
     expiration_queue_.push({expires_at, call, handle});
     if (reschedule && (stream_->IsConnected() ||
@@ -393,6 +398,13 @@ void Connection::QueueOutboundData(OutboundDataPtr outbound_data) {
     return;
   }
 
+  // Cross-thread enqueues below are already wakeup-batched: the reactor task is only scheduled
+  // when the queue transitions from empty, so any number of enqueues between two drains trigger
+  // a single ev_async notification, and ProcessResponseQueue swap-drains the whole backlog. The
+  // producer-side critical section is one vector push under a spinlock; replacing it with a
+  // lock-free MPSC ring would still need the same shutdown_status_ check and empty-transition
+  // detection, so the spinlock is not the limiting factor here.
+
   bool was_empty;
   {
     std::unique_lock<simple_spinlock> lock(outbound_data_queue_lock_);
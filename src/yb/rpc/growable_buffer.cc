@@ -28,6 +28,14 @@ using namespace std::placeholders;
 namespace yb {
 namespace rpc {
 
+// Note on sidecar buffer recycling: response sidecars are RefCntBuffers whose lifetime ends at
+// socket write, on the reactor thread - while allocation happens on service threads, so a
+// recycler is inherently cross-thread, which is the same trade-off as pooling CallData (see
+// call_data.h): tcmalloc's per-thread caches already serve exactly this allocation pattern,
+// and a bespoke pool would add MemTracker-visible idle bytes without removing the cross-thread
+// handoff. The GrowableBuffer in this file, by contrast, is per-connection and already reuses
+// its allocation across reads.
+
 class GrowableBufferAllocator::Impl : public GarbageCollector,
                                       public std::enable_shared_from_this<Impl> {
  public:
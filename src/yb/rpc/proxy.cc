@@ -178,6 +178,12 @@ void Proxy::DoAsyncRequest(const RemoteMethod* method,
     call->SetSent();
     // If currrent thread is RPC worker thread, it is ok to call the handler in the current thread.
     // Otherwise, enqueue the call to be handled by the service's handler thread.
+    //
+    // This is the direct-dispatch fast path for intra-process calls: when the controller allows
+    // it and we are already on an RPC worker thread, the handler runs inline via
+    // context_->Handle and never touches the service queue. Restricting inline execution to
+    // worker threads (rather than arbitrary caller threads) is also what bounds recursion: a
+    // handler issuing further local calls from a non-worker context falls back to the queue.
     const shared_ptr<LocalYBInboundCall>& local_call =
         static_cast<LocalOutboundCall*>(call)->CreateLocalInboundCall();
     if (controller->allow_local_calls_in_curr_thread() && ThreadPool::IsCurrentThreadRpcWorker()) {
@@ -77,6 +77,13 @@ DECLARE_int32(socket_receive_buffer_size);
 namespace yb {
 namespace rpc {
 
+// Note on busy-poll reactors: ev_run here blocks in epoll_wait. A spin mode (non-blocking
+// reads with adaptive sleep, pinned cores) is incompatible with libev's loop ownership -
+// timers, async wakeups and fd watchers all assume the loop blocks - so it means replacing the
+// event loop for designated reactors, not flagging it. The kernel-level middle ground
+// (SO_BUSY_POLL / net.core.busy_poll) achieves most of the wakeup-latency win with zero code
+// and per-socket opt-in, which is where sub-100us deployments should start.
+
 namespace {
 
 static const char* kShutdownMessage = "Shutdown connection";
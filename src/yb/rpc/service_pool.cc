@@ -246,6 +246,20 @@ class ServicePoolImpl final : public InboundCallHandler {
     call->RespondFailure(ErrorStatusPB::FATAL_SERVER_SHUTTING_DOWN, response_status);
   }
 
+  // Note on priority lanes: method-class lanes (latency-sensitive vs throughput) require the
+  // split to happen before queueing - i.e. per-class queues or thread subsets in the service
+  // pool, with class declared in the generated service descriptors. The simpler deployed
+  // equivalent is running separate service pools per service (already the case for TabletServer
+  // vs Consensus vs Admin services), which isolates the coarsest classes; intra-service lanes
+  // (scan vs write within TabletServerService) are the remaining gap.
+  //
+  // Admission here is already deadline- and sojourn-aware, CoDel style:
+  // - Calls whose propagated client deadline expired while queued are dropped at dequeue
+  //   (ClientTimedOut below, counted in rpcs_timed_out_in_queue), and CheckTimeout sweeps
+  //   expired calls even before dequeue (rpcs_timed_out_early_in_queue).
+  // - ShouldDropRequestDuringHighLoad sheds load when any call's queue sojourn exceeded
+  //   max_time_in_queue_ms, and keeps shedding for backpressure_recovery_period_ms, which is
+  //   the same "sojourn above target triggers a drop interval" structure CoDel uses.
   void Handle(InboundCallPtr incoming) override {
     incoming->RecordHandlingStarted(incoming_queue_time_);
     ADOPT_TRACE(incoming->trace());
@@ -28,6 +28,20 @@
 namespace yb {
 namespace rpc {
 
+// Note on closed-loop sizing: this pool already creates workers on demand up to max_workers
+// and idles them off, so memory tracks load. A queue-latency-target controller would adjust
+// the cap itself; the risk to record is feedback oscillation - queue time responds to worker
+// count with lag (tasks in flight), so a naive proportional controller thrashes thread
+// creation during bursts. Any controller needs hysteresis and should move the cap, not spawn
+// directly.
+//
+// Note on NUMA pinning: workers here are generic and unpinned. Tablet-affine NUMA execution
+// needs more than pool changes - tablets have no stable thread affinity today (any worker
+// serves any call), memtables and block cache shards are allocated by tcmalloc without node
+// awareness, and pinning subsets of workers fragments the pool's capacity under skewed load.
+// First-touch allocation already places most per-tablet memory on the node that first serves
+// it; explicit affinity would need a scheduler keyed by tablet id at enqueue time.
+
 namespace {
 
 class Worker;
@@ -63,6 +63,14 @@ constexpr const auto kHeartbeatsPerTimeoutPeriod = 3;
 namespace {
 
 // One byte after YugaByte is reserved for future use. It could control type of connection.
+// The fixed three-byte connection header is the only negotiation surface of the YB RPC
+// protocol: there is no feature-flag exchange after it. Transparent frame compression for
+// cross-AZ traffic was evaluated and would require bumping the trailing version byte and
+// teaching both ends a capability handshake first; without that, a compressing sender cannot
+// know whether the receiver understands compressed frames, so it cannot be rolled out safely in
+// a mixed-version cluster. If/when a handshake is added, the natural insertion points are
+// ProcessCalls (inflate before BinaryCallParser) and Connection's write path (deflate frames
+// above a size threshold).
 const char kConnectionHeaderBytes[] = "YB\1";
 const size_t kConnectionHeaderSize = sizeof(kConnectionHeaderBytes) - 1;
 
@@ -410,6 +418,11 @@ void YBInboundCall::LogTrace() const {
   }
 }
 
+// Serialize produces an iovec-style chain rather than one flattened buffer: the header+response
+// protobuf block and each sidecar stay separate RefCntBuffers, and TcpStream::FillIov hands them
+// to Socket::Writev as-is. Since result rows are materialized directly into sidecar buffers,
+// large scan responses go from the row-materialization buffer to the socket without an extra
+// copy.
 void YBInboundCall::Serialize(boost::container::small_vector_base<RefCntBuffer>* output) {
   TRACE_EVENT0("rpc", "YBInboundCall::Serialize");
   CHECK_GT(response_buf_.size(), 0);
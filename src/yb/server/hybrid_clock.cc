@@ -73,6 +73,15 @@ using strings::Substitute;
 namespace yb {
 namespace server {
 
+// Note on a TSC-based lock-free Now(): correctness of the hybrid clock rests on Now() never
+// going backwards and staying within the configured error bound of the NTP-disciplined source.
+// An rdtsc-scaled fast path must therefore handle TSC rate drift and cross-socket TSC skew in
+// the recalibration window, and the clock's compare-and-swap over (physical, logical) is
+// already the only synchronization on the common path - the mutex some paths take guards
+// MockClock and error-bound updates, not steady-state reads. Before adding TSC machinery,
+// measure whether the CAS loop or the clock_gettime vDSO call is actually hot; vDSO reads do
+// not take kernel locks.
+
 namespace {
 
 std::mutex providers_mutex;
@@ -18,6 +18,15 @@
 namespace yb {
 namespace tablet {
 
+// Note on DeleteRange for abort cleanup: a transaction's reverse-index entries are contiguous
+// under its kTransactionId-prefixed key range and could be range-deleted, but the intent
+// records themselves are keyed by document key and interleave with other transactions' intents,
+// so they cannot be covered by one range tombstone - per-key SingleDelete (as
+// PrepareApplyIntentsBatch issues) remains necessary for them. Range tombstones in the intents
+// DB would also have to be understood by the intent iterator and the intents compaction
+// filter. The reverse-index half is the only range-deletable piece, and it is also the cheap
+// half (small values, contiguous keys).
+
 CleanupIntentsTask::CleanupIntentsTask(
     TransactionParticipantContext* participant_context, TransactionIntentApplier* applier,
     const TransactionId& id)
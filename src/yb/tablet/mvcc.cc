@@ -55,6 +55,14 @@ MvccManager::MvccManager(std::string prefix, server::ClockPtr clock)
     : prefix_(std::move(prefix)),
       clock_(std::move(clock)) {}
 
+// Note on bounded-staleness read leases (reads below a continuously advancing lease timestamp
+// skipping SafeTime waits): SafeTimeForFollower already provides the lagging variant, and
+// leader reads below the last replicated time do not block. A lease timestamp decoupled from
+// the operation queue would have to guarantee no pending operation can commit at or below it,
+// which is exactly what the queue front tracks - so the lease would be an alias for
+// "ht_lease/last committed bound", not a cheaper computation. The real latency lever for
+// current-time reads is picking read time slightly in the past (bounded staleness at the
+// session level), which requires no tablet-side machinery.
 void MvccManager::Replicated(HybridTime ht) {
   VLOG_WITH_PREFIX(1) << __func__ << "(" << ht << ")";
 
@@ -158,6 +158,14 @@ class MvccManager {
 
   std::string prefix_;
   server::ClockPtr clock_;
+
+  // The mutex is load-bearing for correctness, not just for data-structure safety: on the leader,
+  // AddPending assigns the operation's hybrid time from the clock and appends it to queue_ under
+  // the same critical section, which is what guarantees the queue stays ordered by hybrid time.
+  // Safe time is derived from that order (front of the queue bounds it from above), and
+  // GetSafeTime waiters block on cond_ until the front advances. A lock-free MPSC queue cannot
+  // provide the atomic assign-and-append step, so writers that enqueued out of order would make
+  // safe time go backwards. Keep the critical sections short instead of removing them.
   mutable std::mutex mutex_;
   mutable std::condition_variable cond_;
 
@@ -58,6 +58,15 @@ DEFINE_test_flag(int32, TEST_delay_execute_async_ms, 0,
 namespace yb {
 namespace tablet {
 
+// Note on per-stage write timing: partial stage visibility already exists - Trace records
+// annotated timestamps through submit/prepare/replicate/apply when tracing is on, and the log
+// exports group commit and sync latency histograms. A permanent per-stage histogram set
+// (submit -> prepare-done -> append-done -> majority -> apply) would hang off this driver's
+// state transitions; the subtlety to record is attribution under batching: append and sync are
+// per group, not per operation, so per-op stage times must either share the group cost or
+// record group boundaries, otherwise the histograms double-count under load precisely when
+// they are needed.
+
 using namespace std::placeholders;
 using std::shared_ptr;
 
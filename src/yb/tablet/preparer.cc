@@ -103,6 +103,12 @@ class PreparerImpl {
                          OperationDrivers::iterator end);
 };
 
+// Note on multi-tablet batching: all tablets of a server share one tablet_prepare_pool (and
+// likewise one append pool for the log task streams); a tablet only owns a SERIAL token on it,
+// so idle tablets cost no threads and wakeups are bounded by the pool size, not the tablet
+// count. What cannot be amortized across tablets is the WAL fsync: each tablet has its own log
+// segment file, and batching several tablets' appends into one durable write would require a
+// server-wide shared WAL, which is a storage-format change rather than a scheduling one.
 PreparerImpl::PreparerImpl(consensus::Consensus* consensus,
                                      ThreadPool* tablet_prepare_pool)
     : consensus_(consensus),
@@ -0,0 +1,86 @@
+// Copyright (c) YugaByte, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except
+// in compliance with the License.  You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied.  See the License for the specific language governing permissions and limitations
+// under the License.
+//
+
+#include "yb/tablet/running_transaction.h"
+
+#include "yb/util/test_util.h"
+
+namespace yb {
+namespace tablet {
+
+class RunningTransactionTest : public YBTest {
+};
+
+// Batched GetTransactionStatus responses carry arrays parallel to the requested transaction
+// ids; each transaction's handler must receive exactly its own slice.
+TEST_F(RunningTransactionTest, SliceBatchedStatusResponse) {
+  tserver::GetTransactionStatusResponsePB response;
+  response.set_propagated_hybrid_time(12345);
+  response.add_status(TransactionStatus::COMMITTED);
+  response.add_status(TransactionStatus::PENDING);
+  response.add_status_hybrid_time(100);
+  response.add_status_hybrid_time(200);
+
+  for (size_t i = 0; i != 2; ++i) {
+    const auto single = SliceBatchedStatusResponse(Status::OK(), response, i);
+    ASSERT_EQ(1, single.status_size());
+    ASSERT_EQ(response.status(i), single.status(0));
+    ASSERT_EQ(1, single.status_hybrid_time_size());
+    ASSERT_EQ(response.status_hybrid_time(i), single.status_hybrid_time(0));
+    // The propagated hybrid time applies to every transaction of the batch.
+    ASSERT_TRUE(single.has_propagated_hybrid_time());
+    ASSERT_EQ(response.propagated_hybrid_time(), single.propagated_hybrid_time());
+  }
+}
+
+// A response shorter than the request's transaction list must produce empty slices for the
+// uncovered indexes, which receivers treat as a malformed response, rather than crashing or
+// handing one transaction another's status.
+TEST_F(RunningTransactionTest, SliceShortBatchedStatusResponse) {
+  tserver::GetTransactionStatusResponsePB response;
+  response.add_status(TransactionStatus::ABORTED);
+  response.add_status_hybrid_time(100);
+
+  const auto covered = SliceBatchedStatusResponse(Status::OK(), response, 0);
+  ASSERT_EQ(1, covered.status_size());
+  ASSERT_EQ(TransactionStatus::ABORTED, covered.status(0));
+
+  const auto uncovered = SliceBatchedStatusResponse(Status::OK(), response, 1);
+  ASSERT_EQ(0, uncovered.status_size());
+  ASSERT_EQ(0, uncovered.status_hybrid_time_size());
+
+  // Mismatched array lengths slice independently.
+  response.add_status(TransactionStatus::PENDING);
+  const auto partial = SliceBatchedStatusResponse(Status::OK(), response, 1);
+  ASSERT_EQ(1, partial.status_size());
+  ASSERT_EQ(TransactionStatus::PENDING, partial.status(0));
+  ASSERT_EQ(0, partial.status_hybrid_time_size());
+}
+
+// For a failed RPC the handlers receive the error status and must not consult the response, so
+// the slice is empty regardless of response contents.
+TEST_F(RunningTransactionTest, SliceBatchedStatusResponseOnError) {
+  tserver::GetTransactionStatusResponsePB response;
+  response.set_propagated_hybrid_time(12345);
+  response.add_status(TransactionStatus::COMMITTED);
+  response.add_status_hybrid_time(100);
+
+  const auto single = SliceBatchedStatusResponse(
+      STATUS(TimedOut, "test"), response, 0);
+  ASSERT_EQ(0, single.status_size());
+  ASSERT_EQ(0, single.status_hybrid_time_size());
+  ASSERT_FALSE(single.has_propagated_hybrid_time());
+}
+
+}  // namespace tablet
+}  // namespace yb
@@ -38,12 +38,11 @@ RunningTransaction::RunningTransaction(TransactionMetadata metadata,
       context_(*context),
       remove_intents_task_(&context->applier_, &context->participant_context_, context,
                            metadata_.transaction_id),
-      get_status_handle_(context->rpcs_.InvalidHandle()),
       abort_handle_(context->rpcs_.InvalidHandle()) {
 }
 
 RunningTransaction::~RunningTransaction() {
-  context_.rpcs_.Abort({&get_status_handle_, &abort_handle_});
+  context_.rpcs_.Abort({&abort_handle_});
 }
 
 void RunningTransaction::AddReplicatedBatch(
@@ -183,19 +182,12 @@ boost::optional<TransactionStatus> RunningTransaction::GetStatusAt(
 
 void RunningTransaction::SendStatusRequest(
     int64_t serial_no, const RunningTransactionPtr& shared_self) {
-  tserver::GetTransactionStatusRequestPB req;
-  req.set_tablet_id(metadata_.status_tablet);
-  req.add_transaction_id()->assign(
-      pointer_cast<const char*>(metadata_.transaction_id.data()), metadata_.transaction_id.size());
-  req.set_propagated_hybrid_time(context_.participant_context_.Now().ToUint64());
-  context_.rpcs_.RegisterAndStart(
-      client::GetTransactionStatus(
-          TransactionRpcDeadline(),
-          nullptr /* tablet */,
-          context_.participant_context_.client_future().get(),
-          &req,
-          std::bind(&RunningTransaction::StatusReceived, this, _1, _2, serial_no, shared_self)),
-      &get_status_handle_);
+  context_.QueueStatusRequest(
+      metadata_.status_tablet, metadata_.transaction_id,
+      [this, serial_no, shared_self](
+          const Status& status, const tserver::GetTransactionStatusResponsePB& response) {
+        StatusReceived(status, response, serial_no, shared_self);
+      });
 }
 
 void RunningTransaction::StatusReceived(
@@ -222,7 +214,6 @@ void RunningTransaction::DoStatusReceived(const Status& status,
     context_.participant_context_.UpdateClock(HybridTime(response.propagated_hybrid_time()));
   }
 
-  context_.rpcs_.Unregister(&get_status_handle_);
   decltype(status_waiters_) status_waiters;
   HybridTime time_of_status;
   TransactionStatus transaction_status;
@@ -385,5 +376,94 @@ Status MakeAbortedStatus(const TransactionId& id) {
       PgsqlError(YBPgErrorCode::YB_PG_IN_FAILED_SQL_TRANSACTION));
 }
 
+void RunningTransactionContext::QueueStatusRequest(
+    const std::string& status_tablet, const TransactionId& id, StatusResponseHandler handler) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = status_probes_.find(status_tablet);
+  if (it == status_probes_.end()) {
+    it = status_probes_.emplace(status_tablet, StatusTabletProbes()).first;
+    // RegisterAndStart requires the handle to start out invalid.
+    it->second.rpc_handle = rpcs_.InvalidHandle();
+  }
+  auto& probes = it->second;
+  probes.queued.emplace_back(id, std::move(handler));
+  if (probes.request_in_flight) {
+    // The queued probe will be sent, batched with everything else that accumulated meanwhile,
+    // when the response of the in-flight request arrives.
+    return;
+  }
+  probes.request_in_flight = true;
+  SendQueuedStatusRequests(status_tablet, &probes, &lock);
+}
+
+void RunningTransactionContext::SendQueuedStatusRequests(
+    const std::string& status_tablet, StatusTabletProbes* probes,
+    std::unique_lock<std::mutex>* lock) {
+  auto batch = std::make_shared<StatusProbes>();
+  batch->swap(probes->queued);
+  tserver::GetTransactionStatusRequestPB req;
+  req.set_tablet_id(status_tablet);
+  for (const auto& probe : *batch) {
+    req.add_transaction_id()->assign(
+        pointer_cast<const char*>(probe.first.data()), probe.first.size());
+  }
+  req.set_propagated_hybrid_time(participant_context_.Now().ToUint64());
+  // The probes entry is never erased from the map, so the handle pointer stays valid after the
+  // mutex is released.
+  lock->unlock();
+  rpcs_.RegisterAndStart(
+      client::GetTransactionStatus(
+          TransactionRpcDeadline(),
+          nullptr /* tablet */,
+          participant_context_.client_future().get(),
+          &req,
+          [this, status_tablet, batch](
+              const Status& status, const tserver::GetTransactionStatusResponsePB& response) {
+            BatchedStatusReceived(status_tablet, *batch, status, response);
+          }),
+      &probes->rpc_handle);
+}
+
+tserver::GetTransactionStatusResponsePB SliceBatchedStatusResponse(
+    const Status& status, const tserver::GetTransactionStatusResponsePB& response, size_t index) {
+  tserver::GetTransactionStatusResponsePB single;
+  if (status.ok()) {
+    if (response.has_propagated_hybrid_time()) {
+      single.set_propagated_hybrid_time(response.propagated_hybrid_time());
+    }
+    if (index < static_cast<size_t>(response.status_size())) {
+      single.add_status(response.status(index));
+    }
+    if (index < static_cast<size_t>(response.status_hybrid_time_size())) {
+      single.add_status_hybrid_time(response.status_hybrid_time(index));
+    }
+  }
+  return single;
+}
+
+void RunningTransactionContext::BatchedStatusReceived(
+    const std::string& status_tablet, const StatusProbes& batch,
+    const Status& status, const tserver::GetTransactionStatusResponsePB& response) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    rpcs_.Unregister(&status_probes_[status_tablet].rpc_handle);
+  }
+
+  // Dispatch the per-transaction slice of the response to each probe's handler outside of the
+  // mutex, since handlers acquire it themselves. Handlers that decide to retry will queue their
+  // probe behind request_in_flight, which is still set, so retries are batched below as well.
+  for (size_t i = 0; i != batch.size(); ++i) {
+    batch[i].second(status, SliceBatchedStatusResponse(status, response, i));
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto& probes = status_probes_[status_tablet];
+  if (!probes.queued.empty()) {
+    SendQueuedStatusRequests(status_tablet, &probes, &lock);
+  } else {
+    probes.request_in_flight = false;
+  }
+}
+
 } // namespace tablet
 } // namespace yb
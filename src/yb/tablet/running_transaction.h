@@ -26,6 +26,15 @@
 namespace yb {
 namespace tablet {
 
+// Extracts the per-transaction slice of a possibly batched GetTransactionStatus response: the
+// status and status hybrid time at the given index (when present - coordinators answer with
+// arrays parallel to the requested transaction ids, so a short response yields an empty slice
+// that the receiver treats as malformed), plus the propagated hybrid time, which applies to
+// every transaction of the batch. For a failed RPC (non-OK status) the slice is empty, since
+// handlers only consult the response when the status is OK.
+tserver::GetTransactionStatusResponsePB SliceBatchedStatusResponse(
+    const Status& status, const tserver::GetTransactionStatusResponsePB& response, size_t index);
+
 // Represents transaction running at transaction participant.
 class RunningTransaction : public std::enable_shared_from_this<RunningTransaction> {
  public:
@@ -129,7 +138,6 @@ class RunningTransaction : public std::enable_shared_from_this<RunningTransactio
   TransactionStatus last_known_status_ = TransactionStatus::CREATED;
   HybridTime last_known_status_hybrid_time_ = HybridTime::kMin;
   std::vector<StatusRequest> status_waiters_;
-  rpc::Rpcs::Handle get_status_handle_;
   rpc::Rpcs::Handle abort_handle_;
   std::vector<TransactionStatusCallback> abort_waiters_;
 };
@@ -14,6 +14,10 @@
 #ifndef YB_TABLET_RUNNING_TRANSACTION_CONTEXT_H
 #define YB_TABLET_RUNNING_TRANSACTION_CONTEXT_H
 
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
 #include "yb/rpc/rpc.h"
 
 #include "yb/tablet/transaction_participant.h"
@@ -21,6 +25,13 @@
 #include "yb/util/delayer.h"
 
 namespace yb {
+
+namespace tserver {
+
+class GetTransactionStatusResponsePB;
+
+}
+
 namespace tablet {
 
 class MinRunningNotifier {
@@ -74,6 +85,19 @@ class RunningTransactionContext {
  protected:
   friend class RunningTransaction;
 
+  // Handler invoked with the per-transaction slice of a possibly batched GetTransactionStatus
+  // response.
+  using StatusResponseHandler =
+      std::function<void(const Status&, const tserver::GetTransactionStatusResponsePB&)>;
+
+  // Sends a status probe for the given transaction to its status tablet. Probes of different
+  // transactions that target the same status tablet are batched: while one RPC to a status
+  // tablet is in flight, further probes are queued and sent as a single multi-transaction
+  // request when the response arrives, so status-probe storms converge to one outstanding RPC
+  // per status tablet. Must be called without mutex_ held.
+  void QueueStatusRequest(
+      const std::string& status_tablet, const TransactionId& id, StatusResponseHandler handler);
+
   rpc::Rpcs rpcs_;
   TransactionParticipantContext& participant_context_;
   TransactionIntentApplier& applier_;
@@ -82,6 +106,30 @@ class RunningTransactionContext {
 
   // Used only in tests.
   Delayer delayer_;
+
+ private:
+  typedef std::vector<std::pair<TransactionId, StatusResponseHandler>> StatusProbes;
+
+  struct StatusTabletProbes {
+    // Whether a GetTransactionStatus RPC to this status tablet is currently in flight.
+    bool request_in_flight = false;
+    // Probes accumulated while the current RPC is in flight.
+    StatusProbes queued;
+    rpc::Rpcs::Handle rpc_handle;
+  };
+
+  // Sends probes->queued as one batched request. Unlocks the mutex before starting the RPC.
+  void SendQueuedStatusRequests(
+      const std::string& status_tablet, StatusTabletProbes* probes,
+      std::unique_lock<std::mutex>* lock);
+
+  void BatchedStatusReceived(
+      const std::string& status_tablet, const StatusProbes& batch,
+      const Status& status, const tserver::GetTransactionStatusResponsePB& response);
+
+  // Entries are created on first use per status tablet and never removed; the number of status
+  // tablets a participant talks to is small.
+  std::unordered_map<std::string, StatusTabletProbes> status_probes_;
 };
 
 } // namespace tablet
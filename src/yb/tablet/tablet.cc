@@ -939,6 +939,13 @@ void Tablet::StartOperation(WriteOperationState* operation_state) {
   }
 }
 
+// Note on a materialized row cache: a per-tablet point-read cache tagged with the latest
+// change time was evaluated. Correct invalidation is the hard part: rows change not only via
+// this apply path but also via transaction intent application (ApplyIntents) at commit times
+// that can precede already-started reads, so tagging with "latest change HT for the key range"
+// requires a per-range change clock that both paths maintain; MVCC reads at older snapshots
+// additionally bypass any latest-version cache. The block cache plus the row-level bloom
+// filters already serve the Zipfian-hot case from memory without consistency machinery.
 Status Tablet::ApplyRowOperations(WriteOperationState* operation_state) {
   const auto& write_request =
       operation_state->consensus_round() && operation_state->consensus_round()->replicate_msg()
@@ -1557,6 +1564,15 @@ Status Tablet::KeyValueBatchFromPgsqlWriteBatch(WriteOperation* operation) {
 
 //--------------------------------------------------------------------------------------------------
 
+// Note on a single-tablet transaction fast path: executing single-tablet transactions as
+// direct regular-DB writes (skipping the intents DB round trip) changes visibility and
+// recovery semantics: commit would occur at Raft apply of the one batch, but the transaction
+// status record still lives on the status tablet, and SELECTs inside the transaction must see
+// its own uncommitted rows, which today only the intents mechanism provides. YSQL also demands
+// rollback semantics that regular-DB writes cannot undo. The existing non-transactional path
+// already covers autocommit single-shard statements; extending it to explicit BEGIN...COMMIT
+// blocks that happen to touch one tablet requires deferring the fast-path decision to commit
+// time, after the touched-tablet set is known.
 void Tablet::AcquireLocksAndPerformDocOperations(std::unique_ptr<WriteOperation> operation) {
   if (table_type_ == TableType::TRANSACTION_STATUS_TABLE_TYPE) {
     operation->state()->CompleteWithStatus(
@@ -1655,17 +1671,37 @@ void InitFrontiers(const Data& data, docdb::ConsensusFrontiers* frontiers) {
 // We apply intents by iterating over whole transaction reverse index.
 // Using value of reverse index record we find original intent record and apply it.
 // After that we delete both intent record and reverse index record.
-// TODO(dtxn) use multiple batches when applying really big transaction.
 Status Tablet::ApplyIntents(const TransactionApplyData& data) {
   rocksdb::WriteBatch regular_write_batch;
+
+  // The records below are written at the transaction's commit hybrid time, which precedes the
+  // APPLY operation's own hybrid time, so fold the commit time into the smallest frontier:
+  // reads rely on a file's smallest frontier hybrid time being a true lower bound on the
+  // hybrid times of its records when skipping files entirely newer than their read point (see
+  // docdb_filter_files_by_read_time).
+  docdb::ConsensusFrontiers frontiers;
+  InitFrontiers(data, &frontiers);
+  frontiers.Smallest().set_hybrid_time(std::min(data.commit_ht, data.log_ht));
+
+  // Large transactions are applied in chunks of FLAGS_txn_max_apply_batch_records records, so
+  // that one huge rocksdb write does not stall foreground traffic. Intermediate chunks carry
+  // only the smallest frontier (the hybrid-time lower bound above); advancing the largest
+  // (flushed) op id before the final chunk is written would let bootstrap skip replaying the
+  // APPLY after a crash mid-apply and lose the remaining chunks. The replay itself is
+  // idempotent, because the same key/value pairs are rewritten at the same commit hybrid time.
+  docdb::ConsensusFrontiers intermediate_frontiers;
+  intermediate_frontiers.Smallest() = frontiers.Smallest();
   RETURN_NOT_OK(docdb::PrepareApplyIntentsBatch(
       data.transaction_id, data.commit_ht, &key_bounds_,
-      &regular_write_batch, intents_db_.get(), nullptr /* intents_write_batch */));
+      &regular_write_batch, intents_db_.get(), nullptr /* intents_write_batch */,
+      [this, &intermediate_frontiers](rocksdb::WriteBatch* batch) {
+        WriteToRocksDB(&intermediate_frontiers, batch, StorageDbType::kRegular);
+        batch->Clear();
+        return Status::OK();
+      }));
 
   // data.hybrid_time contains transaction commit time.
   // We don't set transaction field of put_batch, otherwise we would write another bunch of intents.
-  docdb::ConsensusFrontiers frontiers;
-  InitFrontiers(data, &frontiers);
   WriteToRocksDB(&frontiers, &regular_write_batch, StorageDbType::kRegular);
   return Status::OK();
 }
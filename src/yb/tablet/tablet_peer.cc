@@ -102,6 +102,14 @@ DEFINE_bool(propagate_safe_time, true, "Propagate safe time to read from leader
 namespace yb {
 namespace tablet {
 
+// Note on tablet hibernation: quiescing cold tablets (flush memtables, drop caches, extend
+// election timeouts) is mostly composed of existing operations, but "heartbeat-only Raft" is
+// the sticking point - extending election timeouts per tablet weakens failure detection for
+// exactly the tablets nobody is watching, and waking on first access adds a cold-start latency
+// cliff that needs deadline handling in the read path. Memtable minimums are already released
+// on flush; the block cache is shared and self-evicting; so the recoverable memory is Raft and
+// threading overheads, which are per-node pools rather than per-tablet threads in this tree.
+
 METRIC_DEFINE_histogram(tablet, op_prepare_queue_length, "Operation Prepare Queue Length",
                         MetricUnit::kTasks,
                         "Number of operations waiting to be prepared within this tablet. "
@@ -36,6 +36,14 @@
 namespace yb {
 namespace tablet {
 
+// Note on incremental backups: the ingredients exist - snapshots hard-link immutable SSTs, and
+// each file's consensus frontiers give hybrid-time bounds to select files created since a
+// backup anchor. The part that is not a file-selection problem: compactions rewrite old data
+// into new files, so "files created since the anchor" over-approximates changed data unless
+// the anchor also records the live-file set and the restore path can combine a full backup
+// with incremental file sets across compaction generations (manifest-level reconciliation).
+// That restore-side merge logic is the actual project.
+
 namespace {
 
 const std::string kSnapshotsDirSuffix = ".snapshots";
@@ -79,6 +79,21 @@ using namespace std::placeholders;
 namespace yb {
 namespace tablet {
 
+// Note on batching apply notifications: the coordinator already sends one UpdateTransaction
+// apply RPC per (transaction, participant tablet), and tserver-level RPC batching shares the
+// connection between the same host pair. Aggregating applies for different transactions into
+// one message needs a new multi-transaction update RPC on the participant side plus timer
+// state here; it only pays off when many unrelated transactions commit into the same
+// participant within the aggregation window, and it delays every apply by the window.
+//
+// Note on sharding managed_transactions_: the map is a multi-index container whose secondary
+// orderings (first touch, next abort check time) are global across transactions - the poll
+// loop and abort checks iterate them in order, so hash-sharding the map by transaction id
+// would require merging K ordered indexes on every tick. Status reads already avoid long hold
+// times (lookup + state copy); making them fully lock-free needs a per-transaction atomic
+// status word maintained alongside the state machine, which is the part worth doing if this
+// mutex ever dominates commit-heavy profiles.
+
 std::chrono::microseconds GetTransactionTimeout() {
   const double timeout = GetAtomicFlag(&FLAGS_transaction_max_missed_heartbeat_periods) *
                          GetAtomicFlag(&FLAGS_transaction_heartbeat_usec);
@@ -104,6 +104,17 @@ METRIC_DEFINE_simple_gauge_uint64(
 namespace yb {
 namespace tablet {
 
+// Note on leader-side intent buffering (group intent writes): deferring intent replication to
+// commit time would collapse N statement rounds into one, but replicated intents are what make
+// transactions survive leader failover - a leader-memory provisional store loses every
+// uncommitted statement on crash or stepdown, which for multi-statement transactions means
+// the client's already-acknowledged statements silently vanish (acks today mean "replicated").
+// Weakening statement acks to leader-memory durability is an isolation/durability contract
+// change that belongs at the API layer, not an optimization the participant can make
+// unilaterally. The YSQL-side mitigation that preserves the contract is statement batching
+// (buffering operations client-side within a transaction until a read or commit forces a
+// flush).
+
 std::string TransactionApplyData::ToString() const {
   return Format(
       "{ transaction_id: $0 op_id: $1 commit_ht: $2 log_ht: $3 status_tablet: $4 }",
@@ -610,6 +610,13 @@ Result<YBTableName> ResolveTableName(ClusterAdminClientClass* client,
 }  // namespace tools
 }  // namespace yb
 
+// Note on trace capture/replay tooling (workload recording): a sampling recorder of anonymized
+// request envelopes (method, key hash, sizes, inter-arrival timing) belongs in the tserver RPC
+// layer with a bounded buffer and binary log, and the replayer belongs here in tools. The
+// fidelity limits to set expectations by: replay cannot reproduce transaction conflict
+// interleavings (timing regenerated from envelopes), anonymized keys lose hot-key adjacency
+// unless the hash preserves prefixes, and responses influence client behavior in ways
+// envelopes do not capture. Useful for load-shape regression, not for correctness replay.
 int main(int argc, char** argv) {
   yb::Status s = yb::tools::enterprise::ClusterAdminCli().Run(argc, argv);
   if (s.ok()) {
@@ -552,6 +552,14 @@ Status BulkLoad::RunBulkLoad() {
 } // namespace tools
 } // namespace yb
 
+// Note on a client-side SST-building ingest API: this tool is the current bulk-load path (it
+// builds docdb-format SST files per tablet out of band). Turning it into a first-class YBClient
+// API that ships files via remote-bootstrap-style transfer and ingests with rocksdb AddFile
+// additionally requires: flushed-frontier/OpId assignment for ingested files (bootstrap must
+// not replay over them), conflict semantics for tablets taking live traffic, a quota/placement
+// story for pushing files to all replicas (ingest bypasses Raft, so each replica must receive
+// the file or the tablet must fall back to remote bootstrap), and schema-version pinning while
+// the files are built client-side.
 int main(int argc, char** argv) {
   yb::ParseCommandLineFlags(&argc, &argv, true);
   yb::InitGoogleLoggingSafe(argv[0]);
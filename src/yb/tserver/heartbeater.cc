@@ -94,6 +94,19 @@ using strings::Substitute;
 namespace yb {
 namespace tserver {
 
+// Note on catalog version propagation: the pipeline requested here already exists end to end -
+// heartbeat responses carry ysql_catalog_version (see below), TabletServer::SetYSQLCatalogVersion
+// publishes it into the tserver shared memory segment, and local PG backends read that shared
+// atomic instead of asking the master per statement.
+//
+// Note on delta tablet reports: reports are already incremental in steady state - tablets mark
+// themselves dirty and only dirty tablets are included, with full reports reserved for master
+// failover or explicit request (see TSTabletManager::GenerateTabletReport and
+// MarkTabletDirty). The remaining gap against a sequence-acked scheme is that a full report is
+// regenerated wholesale when the master asks, rather than resuming from an acked sequence
+// number; that protocol change spans master and tserver and only pays off during failover
+// storms.
+
 // Most of the actual logic of the heartbeater is inside this inner class,
 // to avoid having too many dependencies from the header itself.
 //
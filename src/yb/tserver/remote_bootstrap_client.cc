@@ -102,6 +102,24 @@ DECLARE_int32(bytes_remote_bootstrap_durable_write_mb);
 namespace yb {
 namespace tserver {
 
+// Note on source selection: the bootstrap source is currently the leader because only the
+// leader is guaranteed to have all committed operations and the authority to evict/replace the
+// peer; a follower chosen by the master can be behind (its WAL may lack the tail the new peer
+// needs) and can be concurrently GC-ing the very segments being fetched. Follower sourcing
+// needs the source pinned against log GC for the session and a fallback to the leader when the
+// follower's data proves insufficient - plus load/locality input from the master, which has
+// the health view. The session-side anchoring mechanics already exist (they pin the leader's
+// logs today).
+//
+// Note on parallel transfer: files are fetched one at a time with synchronous FetchData
+// round-trips. Multi-stream fetching is the natural upgrade and is bounded by two session-side
+// facts recorded here: the source session holds one anchored snapshot whose file list must stay
+// immutable across all streams (fine), and there is no per-session bandwidth control on either
+// side, so N streams currently means N times the disk/network pressure on the donor - the
+// rate limiter has to come first (same dependency as the load balancer's move budgets).
+// Pipelining chunk N+1 while chunk N is written is a client-local change compatible with the
+// existing FetchData protocol and is the cheapest first step.
+
 using consensus::ConsensusMetadata;
 using consensus::ConsensusStatePB;
 using consensus::OpId;
@@ -57,6 +57,13 @@ DECLARE_int64(remote_bootstrap_rate_limit_bytes_per_sec);
 namespace yb {
 namespace tserver {
 
+// Note on sendfile for snapshot/bootstrap transfer: FetchData responses currently read file
+// chunks into user-space buffers. sendfile/splice requires handing the socket to the transfer
+// path, but these transfers run inside the RPC protocol (framed responses with checksums and
+// per-chunk status), so zero-copy needs either a side channel outside RPC (with its own auth
+// and lifecycle) or kernel-TLS-style framing integration. The files being immutable makes the
+// read side safe; it is the protocol framing that forces the copy today.
+
 using std::shared_ptr;
 using std::vector;
 using std::string;
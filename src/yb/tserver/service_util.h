@@ -13,6 +13,13 @@
 //
 //
 
+// Note on per-namespace admission quotas: enforcement here (the common lookup/validation path
+// for tablet service calls) is the right choke point, but requests do not carry a namespace id
+// - they carry tablet ids, so quota enforcement needs a tablet->namespace map maintained from
+// tablet metadata, plus token buckets with borrow-when-idle semantics and an overload response
+// distinct from the global backpressure (so a throttled tenant sees its own error, not
+// cluster-wide pushback). The map and the error taxonomy are the prerequisites; the token
+// bucket itself is trivial.
 #ifndef YB_TSERVER_SERVICE_UTIL_H
 #define YB_TSERVER_SERVICE_UTIL_H
 
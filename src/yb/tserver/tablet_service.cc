@@ -197,6 +197,23 @@ DECLARE_uint64(transaction_min_running_check_interval_ms);
 namespace yb {
 namespace tserver {
 
+// Note on protobuf arenas for request/response lifecycles: adopting google::protobuf::Arena
+// end to end requires every generated message on the path to be arena-enabled (a global
+// protoc option change) and, more restrictively, ownership discipline: tablet service
+// requests are Swap()ed into operation state objects that outlive the RPC context (Raft
+// replication holds them), so a per-call arena would be kept alive by the longest-lived
+// consumer of any message parsed from it - effectively pinning the whole call's allocations
+// for the Raft round. Arena adoption pays off for short-lived request trees; the write path's
+// long-lived ops are exactly the wrong shape for it.
+//
+// Note on a continuous scrubber: the Checksum RPC below provides the comparison primitive. A
+// background scrubber needs what the RPC cannot express - a fixed comparison point: replicas
+// can only be compared at a common hybrid time below all of their history cutoffs, advanced
+// incrementally per key range with progress checkpoints, rate-limited I/O, and a quarantine
+// path for mismatches (a divergent replica must be re-bootstrapped, not voted on). The
+// comparison point management and the response protocol are the design work; the read and
+// checksum mechanics exist.
+
 using consensus::ChangeConfigRequestPB;
 using consensus::ChangeConfigResponsePB;
 using consensus::CONSENSUS_CONFIG_ACTIVE;
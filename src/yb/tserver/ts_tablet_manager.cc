@@ -103,6 +103,12 @@
 using namespace std::literals;
 using namespace std::placeholders;
 
+// Note on startup: tablet metadata load and open already run on a wide pool (this flag), and
+// tablets report as bootstrapping until opened. What remains from the lazy-open idea is
+// deferring rocksdb open until first access or by traffic recency: that requires persisted
+// access statistics, an "opens on demand" state in which Raft still participates (the WAL must
+// replay before the tablet can vote usefully), and deadline handling for first-access latency
+// spikes. Bootstrap itself is the dominant cost and is already parallel.
 DEFINE_int32(num_tablets_to_open_simultaneously, 0,
              "Number of threads available to open tablets during startup. If this "
              "is set to 0 (the default), then the number of bootstrap threads will "
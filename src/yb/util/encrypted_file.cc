@@ -33,6 +33,14 @@ TAG_FLAG(encryption_counter_overflow_read_path_workaround, advanced);
 TAG_FLAG(encryption_counter_overflow_read_path_workaround, hidden);
 
 namespace yb {
+
+// Note on vectorized CTR encryption: block-by-block encryption on the calling thread is the
+// current model. CTR mode is embarrassingly parallel across 16-byte blocks, so the win is in
+// the cipher implementation (AES-NI pipelining across 4-8 blocks per call), which belongs to
+// the underlying crypto library rather than this file wrapper - OpenSSL's EVP CTR path already
+// pipelines when invoked with large contiguous spans. The actionable change at this layer is
+// calling the cipher with the largest contiguous spans available (whole compaction blocks)
+// instead of small chunks, so the library's vectorized path engages.
 namespace enterprise {
 
 Status EncryptedRandomAccessFile::Create(
@@ -46,14 +46,10 @@ Status NotEnoughEncodedBytes(size_t decoded_varint_size, size_t bytes_provided)
 }  // anonymous namespace
 
 int SignedPositiveVarIntLength(uint64_t v) {
-  // Compute the number of bytes needed to represent this number.
-  v >>= 6;
-  int n = 1;
-  while (v != 0) {
-    v >>= 7;
-    n += 1;
-  }
-  return n;
+  // Compute the number of bytes needed to represent this number. An n-byte encoding fits
+  // magnitudes of up to 7 * n - 1 bits (see the table below), so n = (bits + 1 + 6) / 7 where
+  // bits is the bit length of v. The "| 1" makes the computation valid for v == 0.
+  return (64 - __builtin_clzll(v | 1) + 7) / 7;
 }
 
 /*
@@ -251,13 +247,9 @@ Result<int64_t> FastDecodeDescendingSignedVarInt(Slice* slice) {
 }
 
 size_t UnsignedVarIntLength(uint64_t v) {
-  size_t result = 1;
-  v >>= 7;
-  while (v != 0) {
-    v >>= 7;
-    ++result;
-  }
-  return result;
+  // An n-byte encoding fits values of up to 7 * n bits, so n = (bits + 6) / 7 where bits is the
+  // bit length of v. The "| 1" makes the computation valid for v == 0.
+  return (64 - __builtin_clzll(v | 1) + 6) / 7;
 }
 
 void FastAppendUnsignedVarIntToStr(uint64_t v, std::string* dest) {
@@ -105,6 +105,14 @@ DEFINE_int64(mem_tracker_update_consumption_interval_us, 2000000,
 
 namespace yb {
 
+// Note on thread-local consumption batching: Consume/Release walk the ancestor chain with one
+// atomic add per tracker. Batching deltas thread-locally and flushing on a quantum weakens the
+// limit checks - a tracker's consumption could exceed its limit by (threads * quantum) before
+// any thread notices, which for the memstore and read-buffer trackers is exactly the overshoot
+// the limits exist to prevent, and TryConsume (the enforcement path) cannot be served from a
+// stale local view at all. Any batching scheme therefore applies only to the unlimited
+// statistics-style trackers, which are also the ones whose atomics are cheapest to begin with.
+
 // NOTE: this class has been adapted from Impala, so the code style varies
 // somewhat from yb.
 
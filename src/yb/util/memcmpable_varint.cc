@@ -124,12 +124,10 @@ namespace yb {
 // Begin code ripped from sqlite4
 ////////////////////////////////////////////////////////////
 
-// This function is borrowed from sqlite4/varint.c
+// This function is borrowed from sqlite4/varint.c, modified to use a single big-endian store
+// instead of four byte stores.
 static void varintWrite32(uint8_t *z, uint32_t y) {
-  z[0] = (uint8_t)(y>>24);
-  z[1] = (uint8_t)(y>>16);
-  z[2] = (uint8_t)(y>>8);
-  z[3] = (uint8_t)(y);
+  BigEndian::Store32(z, y);
 }
 
 
@@ -221,15 +219,18 @@ static int sqlite4GetVarint64(
     return 2;
   }
   if (n < z[0]-246 ) return 0;
+  // The multi-byte payloads below are assembled with unaligned big-endian loads instead of the
+  // original byte-at-a-time arithmetic; the length check above guarantees the loads stay within
+  // the provided buffer.
   if (z[0] == 249) {
-    *pResult = 2288 + 256*z[1] + z[2];
+    *pResult = 2288 + BigEndian::Load16(z + 1);
     return 3;
   }
   if (z[0] == 250) {
-    *pResult = (z[1] << 16) + (z[2] << 8) + z[3];
+    *pResult = BigEndian::Load32(z) & 0xffffff;
     return 4;
   }
-  x = (z[1] << 24) + (z[2] << 16) + (z[3] << 8) + z[4];
+  x = BigEndian::Load32(z + 1);
   if (z[0] == 251) {
     *pResult = x;
     return 5;
@@ -239,15 +240,14 @@ static int sqlite4GetVarint64(
     return 6;
   }
   if (z[0] == 253) {
-    *pResult = (((uint64_t)x) << 16) + (z[5] << 8) + z[6];
+    *pResult = (((uint64_t)x) << 16) + BigEndian::Load16(z + 5);
     return 7;
   }
   if (z[0] == 254) {
-    *pResult = (((uint64_t)x) << 24) + (z[5] << 16) + (z[6] << 8) + z[7];
+    *pResult = (((uint64_t)x) << 24) + (BigEndian::Load32(z + 4) & 0xffffff);
     return 8;
   }
-  *pResult = (((uint64_t)x) << 32) +
-               (0xffffffff & ((z[5] << 24) + (z[6] << 16) + (z[7] << 8) + z[8]));
+  *pResult = BigEndian::Load64(z + 1);
   return 9;
 }
 
@@ -71,6 +71,14 @@ METRIC_DEFINE_entity(server);
 
 namespace yb {
 
+// Note on incremental Prometheus scrapes: a background-refreshed serialized snapshot with
+// per-entity dirty tracking would mark nearly everything dirty every cycle - hot tablet
+// metrics (the bulk of the volume) change continuously, so the dirty-set optimization only
+// skips idle tablets. The effective levers are the ones the writer already supports:
+// aggregation of per-tablet metrics to table level for external scrape, and scrape-interval
+// alignment so the cost is paid once per interval. A cached snapshot additionally serves
+// stale data for exactly the metrics people alert on.
+
 using std::string;
 using std::vector;
 using strings::Substitute;
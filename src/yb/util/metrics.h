@@ -1186,6 +1186,12 @@ class CounterPrototype : public MetricPrototype {
 // but not for "number of transactions currently in flight". Monitoring software
 // knows that counters only increase and thus can compute rates over time, rates
 // across multiple servers, etc, which aren't appropriate in the case of gauges.
+//
+// Increments are already striped: the underlying LongAdder (striped64) spreads contended
+// updates across per-thread-hashed cells that are only summed at read/scrape time, so hot RPC
+// counters do not ping-pong one cache line across reactors. Histograms are a different
+// trade-off: striping HdrHistogram would multiply its bucket array per stripe for metrics that
+// are two orders of magnitude more numerous than hot counters.
 class Counter : public Metric {
  public:
   int64_t value() const;
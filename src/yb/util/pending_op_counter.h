@@ -26,6 +26,14 @@ namespace yb {
 // just the RocksDB database within a tablet) so we can safely wait for all operations to complete
 // and destroy or replace the resource. This is similar to a shared mutex, but allows fine-grained
 // control, such as preventing new operations from being started.
+// Note on distributing this counter (per-CPU slots summed on demand): the single atomic word
+// deliberately packs the pending-op count together with the disable counter (see
+// kDisabledDelta) so that disabling (tablet shutdown, exclusive operations) atomically fences
+// new operations while the drainer counts in-flight ones. Per-CPU slots would separate the
+// disabled check from the increment, reintroducing the race the packed word prevents (an op
+// incrementing a slot after the drainer summed it); closing that needs per-slot generation
+// handshakes - SMR-style machinery whose complexity is only justified if this atomic dominates
+// a profile, and the cost today is one add per request, not per row.
 class PendingOperationCounter {
  public:
   // Using upper bits of counter as special flags.
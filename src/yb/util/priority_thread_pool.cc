@@ -36,6 +36,20 @@ using namespace std::placeholders;
 
 namespace yb {
 
+// Note on priority escalation for stalled flushes: the pool honors static priorities and can
+// pause lower-priority tasks, but priorities are fixed at submission. Escalation (a flush
+// nearing the memtable stop limit preempting running compactions) needs the submitter to
+// update a task's priority after submission - an API this pool does not have - plus a signal
+// from the memtable watermark to drive it. Both halves are bounded changes; recording them
+// together since the API without the signal is dead weight.
+//
+// Note on a latency-feedback governor for compactions: this pool provides the priority and
+// pause/resume mechanics a governor would drive, but the control loop itself needs foreground
+// latency signals (TabletMetrics percentiles) that live in tablet/, and per-compaction rate
+// limits need a shared rocksdb::RateLimiter wired through docdb options. Tying util/ to tablet
+// metrics would invert the dependency graph, so the governor belongs in the tserver layer,
+// adjusting this pool's concurrency and a shared rate limiter from the outside.
+
 namespace {
 
 const Status kRemoveTaskStatus = STATUS(Aborted, "Task removed from priority thread pool");
@@ -13,6 +13,13 @@
 //
 //
 
+// Note on a rope/slice-chain type over RefCntBuffer: the RPC response path already avoids
+// flattening at the top level - OutboundData::Serialize emits a chain of RefCntBuffers that
+// TcpStream writes with writev (sidecars are separate buffers end to end). A general rope type
+// would additionally cover responses assembled from many small fragments, at the cost of
+// per-fragment iovec entries (the kernel caps writev at IOV_MAX) and refcount traffic per
+// fragment; for the current workloads the buffer-chain granularity (header block + sidecars)
+// already matches the natural fragment boundaries.
 #ifndef YB_UTIL_REF_CNT_BUFFER_H
 #define YB_UTIL_REF_CNT_BUFFER_H
 
@@ -65,6 +65,13 @@ using base::SpinLockHolder;
 
 namespace yb {
 
+// Note on extending contention profiling beyond gutil spinlocks: the ring/stack machinery here
+// is reusable, but yb::Mutex and std::mutex wrappers sit on hotter paths where even sampled
+// instrumentation (clock reads on the contended path) costs more than the spinlock case this
+// was built for, and std::mutex offers no contention hook without wrapping every acquisition.
+// A build-mode-gated wrapper for util/locks.h Mutex feeding these rings is the workable shape,
+// with the /contention-profile endpoint reading the same buffers.
+
 static const double kMicrosPerSecond = 1000000.0;
 
 static LongAdder* g_contended_cycles = nullptr;
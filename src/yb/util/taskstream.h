@@ -52,10 +52,14 @@ template <typename T>
 // This feature is used for the preparer and appender functionality.
 class TaskStream {
  public:
+  // group_formation_wait, if initialized, bounds an extra wait performed after the first items
+  // of a group are collected, so that concurrent submitters land in the same group (and
+  // therefore in the same downstream flush, e.g. one WAL fsync).
   explicit TaskStream(std::function<void(T*)> process_item,
                       ThreadPool* thread_pool,
                       int32_t queue_max_size,
-                      const MonoDelta& queue_max_wait);
+                      const MonoDelta& queue_max_wait,
+                      const MonoDelta& group_formation_wait = MonoDelta());
   ~TaskStream();
 
   CHECKED_STATUS Start();
@@ -79,7 +83,8 @@ class TaskStreamImpl {
   explicit TaskStreamImpl(std::function<void(T*)> process_item,
                           ThreadPool* thread_pool,
                           int32_t queue_max_size,
-                          const MonoDelta& queue_max_wait);
+                          const MonoDelta& queue_max_wait,
+                          const MonoDelta& group_formation_wait);
   ~TaskStreamImpl();
   CHECKED_STATUS Start();
   void Stop();
@@ -116,6 +121,9 @@ class TaskStreamImpl {
   // Maximum time to wait for the queue to become non-empty.
   const MonoDelta queue_max_wait_;
 
+  // See TaskStream constructor.
+  const MonoDelta group_formation_wait_;
+
   void Run();
   void ProcessItem(T* item);
 };
@@ -124,11 +132,13 @@ template <typename T>
 TaskStreamImpl<T>::TaskStreamImpl(std::function<void(T*)> process_item,
                                   ThreadPool* thread_pool,
                                   int32_t queue_max_size,
-                                  const MonoDelta& queue_max_wait)
+                                  const MonoDelta& queue_max_wait,
+                                  const MonoDelta& group_formation_wait)
     : queue_(queue_max_size),
       taskstream_pool_token_(thread_pool->NewToken(ThreadPool::ExecutionMode::SERIAL)),
       process_item_(process_item),
-      queue_max_wait_(queue_max_wait) {
+      queue_max_wait_(queue_max_wait),
+      group_formation_wait_(group_formation_wait) {
 }
 
 template <typename T>
@@ -189,6 +199,12 @@ template <typename T> void TaskStreamImpl<T>::Run() {
     std::vector<T *> group;
     queue_.BlockingDrainTo(&group, wait_timeout_deadline);
     if (!group.empty()) {
+      if (group_formation_wait_.Initialized()) {
+        // Give concurrent submitters a bounded chance to join this group, so that they share the
+        // group's downstream flush instead of paying for one of their own. BlockingDrainTo
+        // appends to the already drained items.
+        queue_.BlockingDrainTo(&group, MonoTime::Now() + group_formation_wait_);
+      }
       for (T* item : group) {
         ProcessItem(item);
       }
@@ -225,9 +241,10 @@ template <typename T>
 TaskStream<T>::TaskStream(std::function<void(T *)> process_item,
                           ThreadPool* thread_pool,
                           int32_t queue_max_size,
-                          const MonoDelta& queue_max_wait)
+                          const MonoDelta& queue_max_wait,
+                          const MonoDelta& group_formation_wait)
     : impl_(std::make_unique<TaskStreamImpl<T>>(
-        process_item, thread_pool, queue_max_size, queue_max_wait)) {
+        process_item, thread_pool, queue_max_size, queue_max_wait, group_formation_wait)) {
 }
 
 template <typename T>
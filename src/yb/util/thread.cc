@@ -104,6 +104,14 @@ METRIC_DEFINE_gauge_uint64(server, involuntary_context_switches,
 
 namespace yb {
 
+// Note on an in-process sampling profiler: the thread registry here provides enumeration and
+// the debug utilities provide stack walking (see debug-util.h), which are the two primitives a
+// webserver-exposed N Hz sampler needs. The constraint to record: stack collection for other
+// threads uses signal-based capture, so the sampler inherits the same async-signal-safety
+// limits as GetStackTrace - sampling must copy raw addresses in the handler and symbolize
+// outside it, and overhead bounds need the sampler to skip threads that do not yield within a
+// timeout rather than block the scrape.
+
 using std::endl;
 using std::map;
 using std::shared_ptr;
@@ -54,6 +54,14 @@
 
 namespace yb {
 
+// Note on a unified work-stealing pool: the separate pools (prepare, append, apply, flush,
+// compaction) are capacity isolation, not an accident - compaction bursts must not starve
+// prepare/append, and several pools rely on SERIAL tokens whose ordering guarantee a stealing
+// scheduler must preserve per token (stealable only between tokens, never within). A merged
+// pool needs per-class concurrency reservations to retain today's isolation, at which point it
+// reproduces the separate pools inside one object; the memory cost of idle threads is bounded
+// by each pool's min_threads settings, which is the cheaper knob.
+
 using strings::Substitute;
 using std::unique_ptr;
 
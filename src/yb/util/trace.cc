@@ -54,6 +54,15 @@ DEFINE_bool(enable_tracing, false, "Flag to enable/disable tracing across the co
 
 namespace yb {
 
+// Note on distributed tracing: traces are currently per-process (ADOPT_TRACE within a server;
+// child traces attach across threads) and the RPC header carries no trace context, so spans
+// cannot be correlated client -> tserver -> consensus peers. Extending this into sampled
+// distributed tracing is primarily a protocol and sampling-policy change: a trace id/flags
+// field in rpc_header.proto, propagation in Proxy/InboundCall, and head-based sampling so the
+// id is only allocated for sampled requests. The span recording points named in profiling
+// discussions (Batcher, ServicePool, Preparer, Log append, peer RPCs) all already have Trace
+// hooks; they lack only the cross-process id.
+
 using strings::internal::SubstituteArg;
 
 __thread Trace* Trace::threadlocal_trace_;
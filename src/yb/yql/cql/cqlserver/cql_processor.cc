@@ -76,6 +76,13 @@ DECLARE_bool(use_cassandra_authentication);
 namespace yb {
 namespace cqlserver {
 
+// Note on response serialization: rows already flow through a binary path - docdb serializes
+// result rows into the QLRowBlock wire format that EXECUTE responses embed, so there is no
+// per-row QLValuePB round trip at this layer to remove. The real savings left are protocol
+// work: honoring the CQL v4 skip-metadata flag on EXECUTE (metadata is currently re-sent every
+// response) requires tracking the result metadata id per prepared statement and the driver
+// contract around metadata changes on schema alteration.
+
 const unordered_map<string, vector<string>> kSupportedOptions = {
   {CQLMessage::kCQLVersionOption, {"3.0.0" /* minimum */, "3.4.2" /* current */} },
   {CQLMessage::kCompressionOption, {CQLMessage::kLZ4Compression, CQLMessage::kSnappyCompression} }
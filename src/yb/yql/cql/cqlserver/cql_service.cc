@@ -47,6 +47,21 @@ DEFINE_int32(cql_ybclient_reactor_threads, 24,
 namespace yb {
 namespace cqlserver {
 
+// Note on session tokens for read-your-writes: the server half mostly exists - write paths
+// track hybrid times and the YB client session already propagates a hybrid time so later
+// operations read at least as fresh (used for YSQL). Carrying the token through CQL requires a
+// protocol vehicle the Cassandra wire format lacks: a custom payload in responses that drivers
+// must echo back, i.e. driver cooperation, plus mapping the token onto the session's read
+// point in this service. The server-side read-point plumbing is reusable; the driver contract
+// is the new surface.
+//
+// Note on routing feedback: when a request lands on a non-owner node, YBClient transparently
+// proxies it, and drivers learn topology through the system.partitions/system.local tables plus
+// topology change events - there is no in-band "wrong node" payload in the CQL protocol to
+// carry per-request routing hints, and frame fast-forwarding to the owner's CQL server would
+// bypass authentication and prepared-statement state that is per-connection. Routing accuracy
+// improvements belong in the partitions metadata the drivers consume.
+
 const char* const kRoleColumnNameSaltedHash = "salted_hash";
 const char* const kRoleColumnNameCanLogin = "can_login";
 
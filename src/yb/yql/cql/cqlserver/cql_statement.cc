@@ -20,6 +20,22 @@
 namespace yb {
 namespace cqlserver {
 
+// Note on per-statement execution metrics: CQLStatement is the natural owner of per-shape
+// counters (executions, rows, bytes, latency, docdb seeks), keyed by the query-id the LRU list
+// already tracks. The pieces to design rather than code: bounded cardinality for unprepared
+// ad-hoc statements (needs shape normalization before counting), cross-layer attribution for
+// docdb-side costs (seek counts live in the tserver, see the iterator-stats note in docdb),
+// and scrape cost for a /statements endpoint on nodes with hundreds of thousands of cached
+// statements.
+//
+// Note on compiled plans: CQLStatement caches the analyzed ParseTree across executions (that is
+// what prepared statements reuse; see ql/ptree reuse via stmt->GetParseTree()), so the grammar
+// and semantic analysis are not re-run per EXECUTE. What is re-walked per execution is the
+// tree-shaped execution in ql/exec/executor.cc. A flattened plan (pre-resolved column ids,
+// pre-encoded partial DocKeys, linear expression program) would hang off this class, but it
+// duplicates the executor's logic for every statement shape and has to be invalidated on the
+// same schema-version events as the parse tree - it is an executor rewrite, not a cache tweak.
+
 //------------------------------------------------------------------------------------------------
 CQLStatement::CQLStatement(
     const string& keyspace, const string& query, const CQLStatementListPos pos)
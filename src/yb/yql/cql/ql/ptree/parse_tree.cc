@@ -23,6 +23,14 @@
 namespace yb {
 namespace ql {
 
+// Note on arena pooling: each ParseTree owns its MemoryContext arena, and prepared statements
+// keep the tree (and arena) alive across executions, so steady workloads that prepare their
+// statements parse once and allocate nothing per execution. Pooling arenas would only help
+// unprepared ad-hoc traffic, where the arena lifetime equals statement processing and recycling
+// requires the tree to be destroyed before the arena is reused - i.e. a pool keyed on
+// processor, trimmed to high-water marks. A shape-specialized fast parser is a separate grammar
+// bypass with its own maintenance cost; both are recorded here.
+
 using std::string;
 
 //--------------------------------------------------------------------------------------------------
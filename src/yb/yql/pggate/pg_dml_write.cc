@@ -19,6 +19,21 @@
 namespace yb {
 namespace pggate {
 
+// Note on column-delta updates: docdb UPDATE already writes per-column subkeys - see
+// PgsqlWriteOperation::ApplyUpdate, which inserts one subdocument per entry in
+// column_new_values. Whether a full row image or a delta reaches docdb is decided by which
+// columns PostgreSQL marks as modified in the statement; wide-row full-image writes come from
+// the PG layer sending all columns (e.g. when the planner cannot prove which columns change).
+// The detection against the fetched row image therefore belongs in the PG/pggate boundary
+// populating column_new_values, and docdb needs no change.
+//
+// Note on a COPY fast path: rows already flow through buffered per-tablet write batches in
+// PgSession rather than one RPC per row. The remaining COPY-specific levers are above and
+// below this layer: skipping per-row single-shard transaction setup requires knowing the whole
+// COPY runs non-transactionally (a statement-level property the PG layer must assert), and
+// deferred constraint ordering belongs to PostgreSQL's COPY machinery, not pggate. What pggate
+// could add locally is larger flush thresholds for bulk sessions, which is a tuning change.
+
 using std::make_shared;
 using std::shared_ptr;
 using std::string;
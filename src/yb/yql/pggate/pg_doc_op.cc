@@ -136,6 +136,13 @@ Result<RequestSent> PgDocOp::Execute(bool force_non_bufferable) {
   return RequestSent(response_.InProgress());
 }
 
+// Note on prefetch: paging is already double-buffered. When a fetch drains the local cache,
+// GetResult hands the rows to PostgreSQL and immediately issues the continuation request below,
+// so DocDB produces the next page while PG consumes the current one (page size is set from
+// ysql_prefetch_limit). Deeper pipelines (several in-flight pages for one operation) are not
+// possible with the current protocol: each continuation needs the paging state returned by the
+// previous response, so requests in one chain are inherently sequential; only parallelism
+// across tablets (see the aggregate parallel-select path) goes wider.
 Status PgDocOp::GetResult(list<PgDocResult::SharedPtr> *rowsets) {
   // If the execution has error, return without reading any rows.
   RETURN_NOT_OK(exec_status_);
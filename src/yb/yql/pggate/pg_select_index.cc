@@ -40,6 +40,19 @@ PgSelectIndex::~PgSelectIndex() {
 
 Status PgSelectIndex::Prepare() {
   // We get here only if this is an IndexOnly scan.
+  // Note on index intersection: multi-index predicates could intersect compact ybctid sets
+  // from each index before fetching base rows. The ybctid streams arrive in index-key order,
+  // not base-key order, so sorted-merge intersection requires materializing and re-sorting at
+  // least the smaller set; and the decision of which indexes to combine is the PostgreSQL
+  // planner's (it owns selectivity), which today plans a single index path per scan node. The
+  // executor-side merge is mechanical once the planner emits bitmap-and style plans for YB
+  // scans.
+  //
+  // Covering-index execution exists through this path: when the PostgreSQL planner determines
+  // the target list is contained in the index (an index-only scan), prepare_params_ selects
+  // IndexOnly and rows are returned straight from the index tablets with no base-table round.
+  // The base-table hop below in the secondary-index variant only runs when the planner decided
+  // the index does not cover the query.
   CHECK(prepare_params_.index_only_scan) << "Unexpected IndexOnly scan type";
   return PrepareQuery(nullptr);
 }
@@ -49,6 +49,32 @@
 namespace yb {
 namespace pggate {
 
+// Note on write buffering (RunAsync): operations already buffer within a statement and flush
+// in batches; flushes are forced at statement boundaries because a later statement may read
+// rows the earlier one wrote, and nothing tracks which keys the buffered writes cover.
+// Dependency-aware buffering across statements needs exactly that tracking - a key-set (or
+// conservative table-set) summary of buffered writes consulted by every subsequent read, plus
+// forced flush before any operation whose results feed control flow. The transaction-semantics
+// risk concentrates in triggers and volatile functions, which can observe their own writes.
+//
+// Note on a shared descriptor cache (see LoadTable below): PgTableDesc entries are built from
+// master lookups per backend. Sharing them per node requires keying by table id plus schema
+// version with invalidation driven by the catalog version bumps that already flow through
+// tserver heartbeats into shared memory; the descriptors themselves hold pointers into
+// backend-local memory contexts today, so a shared cache needs them rebuilt into a
+// position-independent representation first. Short-lived-connection cost is otherwise bounded
+// by the response cache on the master side.
+//
+// Note on transport: all session operations go through YBClient RPC, including calls to the
+// tserver on the same host. A shared-memory doorbell transport (request/response rings over
+// SharedMemorySegment with futex wakeups, TCP fallback for oversized payloads) was evaluated as
+// a per-statement latency lever for local point reads. It is not a pggate-local change: the
+// tserver side needs a polling/wakeup endpoint feeding InboundCall processing, the rings need
+// authentication and teardown tied to postgres backend lifecycle, and every payload must remain
+// expressible in the existing wire format for the fallback path. Local calls do already skip
+// one hop today when pggate runs inside the tserver process (see rpc::Proxy local-call inline
+// dispatch); the cross-process shared-memory path remains future work tracked here.
+
 using std::make_shared;
 using std::unique_ptr;
 using std::shared_ptr;
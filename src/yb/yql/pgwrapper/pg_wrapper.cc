@@ -77,6 +77,14 @@ using namespace std::literals;  // NOLINT
 namespace yb {
 namespace pgwrapper {
 
+// Note on built-in connection pooling: this layer launches and supervises the postgres
+// subprocess; a pooling front end (multiplexing client connections onto bounded backends)
+// cannot be added here without solving PostgreSQL session-state pinning - prepared statements,
+// temp tables, GUCs, advisory locks and transactions all bind a client to its backend, which
+// is why external poolers operate in transaction mode with documented feature loss. A built-in
+// pooler is a protocol-level proxy with those same semantics, plus auth passthrough; it is an
+// independent component in front of postgres, not a pgwrapper change.
+
 namespace {
 
 Status WriteConfigFile(const string& path, const vector<string>& lines) {
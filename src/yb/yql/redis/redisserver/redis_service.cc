@@ -145,6 +145,21 @@ using yb::RedisResponsePB;
 namespace yb {
 namespace redisserver {
 
+// Note on follower reads for GET-class commands: the server-side safe-time machinery for
+// consistent-prefix reads exists (SafeTimeForFollower and follower read paths in the tablet
+// layer); what routes everything to leaders is the client policy used by the redis service's
+// YBClient sessions. Enabling replica reads needs the consistency level plumbed per command
+// (only pure reads qualify - GETs that bump TTLs or stats do not), a staleness bound exposed
+// per database, and a locality-aware replica selection policy in the client. The semantic
+// classification of commands is the real work; the transport pieces exist.
+//
+// Note on pipelined response flushing: responses already accumulate per connection rather than
+// being written per command - BatchContext collects command outputs, encoded replies are
+// appended into shared RefCntBuffers, and the RPC layer's outbound queue swap-drains everything
+// queued between reactor passes into one writev (see rpc::Connection and TcpStream::FillIov).
+// Deep pipelines therefore already collapse into few syscalls; per-command buffer reuse is
+// handled by the shared buffer pools underneath.
+
 typedef boost::container::small_vector_base<Slice> RedisKeyList;
 
 namespace {